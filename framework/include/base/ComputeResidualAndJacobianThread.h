@@ -0,0 +1,51 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPUTERESIDUALANDJACOBIANTHREAD_H
+#define COMPUTERESIDUALANDJACOBIANTHREAD_H
+
+#include "ComputeFullJacobianThread.h"
+
+// Forward declarations
+class FEProblemBase;
+
+/**
+ * Computes the residual and the Jacobian contributions of Kernels, IntegratedBCs, DGKernels and
+ * InterfaceKernels in a single element loop, so that the element, face and material reinit is done
+ * once for both.
+ *
+ * The Jacobian is computed for all the coupling entries of the problem (like
+ * ComputeFullJacobianThread), the residual for all the kernels (like ComputeResidualThread with
+ * Moose::KT_ALL).
+ */
+class ComputeResidualAndJacobianThread : public ComputeFullJacobianThread
+{
+public:
+  ComputeResidualAndJacobianThread(FEProblemBase & fe_problem, SparseMatrix<Number> & jacobian);
+
+  // Splitting Constructor
+  ComputeResidualAndJacobianThread(ComputeResidualAndJacobianThread & x, Threads::split split);
+
+  virtual ~ComputeResidualAndJacobianThread();
+
+  virtual void onElement(const Elem * elem) override;
+  virtual void onBoundary(const Elem * elem, unsigned int side, BoundaryID bnd_id) override;
+  virtual void onInternalSide(const Elem * elem, unsigned int side) override;
+  virtual void onInterface(const Elem * elem, unsigned int side, BoundaryID bnd_id) override;
+  virtual void postElement(const Elem * /*elem*/) override;
+
+  void join(const ComputeResidualAndJacobianThread & /*y*/) {}
+};
+
+#endif //COMPUTERESIDUALANDJACOBIANTHREAD_H
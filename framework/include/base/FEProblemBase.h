@@ -29,6 +29,7 @@
 #include "ExecuteMooseObjectWarehouse.h"
 #include "AuxGroupExecuteMooseObjectWarehouse.h"
 #include "MaterialWarehouse.h"
+#include "MaterialPropertyCache.h"
 #include "MultiAppTransfer.h"
 #include "Postprocessor.h"
 
@@ -402,6 +403,19 @@ public:
    */
   virtual bool currentlyComputingJacobian() { return _currently_computing_jacobian; }
 
+  /**
+   * Called by the linear convergence test when the linear solve stops.  The residuals computed
+   * between a Jacobian evaluation and the end of the following linear solve (the finite
+   * differencing of a matrix-free operator) are not followed by a Jacobian evaluation.
+   */
+  void linearSolveFinished() { _solving_linear_system = false; }
+
+  /**
+   * The number of elements whose material property values were restored from the material caches
+   * on this processor (see "cache_materials")
+   */
+  unsigned long numMaterialCacheRestores() const;
+
   /**
    * Returns true if we are in or beyond the initialSetup stage
    */
@@ -872,6 +886,12 @@ public:
 
   virtual void possiblyRebuildGeomSearchPatches();
 
+  /**
+   * @return The number of times the geometric search patches have been rebuilt
+   * by possiblyRebuildGeomSearchPatches().
+   */
+  unsigned int numGeomSearchPatchUpdates() const { return _num_geom_search_patch_updates; }
+
   virtual GeometricSearchData & geomSearchData() override { return _geometric_search_data; }
 
   /**
@@ -1128,6 +1148,25 @@ protected:
   VectorPostprocessorData & getVectorPostprocessorData();
   ///@}
 
+  /**
+   * Computes the given block materials on the current element.  If \p use_cache is true their
+   * values are stored into or restored from the material caches (see "cache_materials").
+   */
+  void reinitBlockMaterials(const std::vector<std::shared_ptr<Material>> & materials, bool use_cache, THREAD_ID tid);
+
+  /**
+   * Whether the solver follows the residual evaluation it is requesting with a Jacobian evaluation
+   * at the same solution.  This excludes the residuals computed by MOOSE itself, the finite
+   * differencing of a matrix-free operator, the trial points of a line search that may be rejected
+   * and lagged Jacobians.  The residual at the converged solution can not be told apart.
+   */
+  bool residualPrecedesJacobian(NonlinearImplicitSystem & sys);
+
+  /**
+   * Whether \p soln is exactly the solution \p stored
+   */
+  bool isSameSolution(const NumericVector<Number> & stored, const NumericVector<Number> & soln);
+
 
   MooseMesh & _mesh;
   EquationSystems _eq;
@@ -1191,6 +1230,51 @@ protected:
   MaterialWarehouse _all_materials; // All materials for error checking and MaterialData storage
   ///@}
 
+  ///@{
+  /// The block materials selected by prepareMaterials() to supply the active material properties
+  /// and the subdomain they were selected for (per thread)
+  std::vector<std::vector<std::shared_ptr<Material>>> _needed_block_materials;
+  std::vector<SubdomainID> _needed_block_materials_id;
+  ///@}
+
+  /// Whether the block material property values computed during a residual evaluation are
+  /// reused by a Jacobian evaluation at the same solution
+  const bool _cache_materials;
+
+  /// The cached block material property values (per thread)
+  std::vector<std::unique_ptr<MaterialPropertyCache>> _material_caches;
+
+  ///@{
+  /// The solution and time of the residual evaluation that filled the material caches
+  std::unique_ptr<NumericVector<Number>> _material_cache_solution;
+  Real _material_cache_time;
+  ///@}
+
+  ///@{
+  /// Whether reinitMaterials() currently stores values into or restores them from the material caches
+  bool _material_cache_store;
+  bool _material_cache_restore;
+  ///@}
+
+  /// Whether the linear solve that follows a Jacobian evaluation is running (see linearSolveFinished())
+  bool _solving_linear_system;
+
+  /// Whether Newton residual evaluations also assemble the element contributions to the Jacobian
+  const bool _residual_and_jacobian_together;
+
+  /// The Jacobian the current residual evaluation assembles the element contributions for (or NULL)
+  SparseMatrix<Number> * _fused_jacobian;
+
+  /// Whether the element Jacobian of the last residual evaluation waits for its Jacobian evaluation
+  bool _has_fused_jacobian;
+
+  ///@{
+  /// The matrix, solution and time of the residual evaluation that assembled the element Jacobian
+  SparseMatrix<Number> * _fused_jacobian_matrix;
+  std::unique_ptr<NumericVector<Number>> _fused_jacobian_solution;
+  Real _fused_jacobian_time;
+  ///@}
+
   ///@{
   // Indicator Warehouses
   MooseObjectWarehouse<Indicator> _indicators;
@@ -1276,6 +1360,9 @@ protected:
   std::shared_ptr<DisplacedProblem> _displaced_problem;
   GeometricSearchData _geometric_search_data;
 
+  /// Number of times the geometric search patches have been rebuilt
+  unsigned int _num_geom_search_patch_updates;
+
   bool _reinit_displaced_elem;
   bool _reinit_displaced_face;
 
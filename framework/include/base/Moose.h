@@ -59,6 +59,8 @@ class Factory;
 // forward declarations
 class Syntax;
 class FEProblemBase;
+class PerfGraph;
+class ObjectTiming;
 
 
 namespace Moose
@@ -66,7 +68,7 @@ namespace Moose
 
 /**
  * Perflog to be used by applications.
- * If the application prints this in the end they will get performance info.
+ * The framework sections are timed by perf_graph, the events logged here are printed after it.
  */
 extern PerfLog perf_log;
 
@@ -74,6 +76,16 @@ extern PerfLog perf_log;
  * PerfLog to be used during setup.  This log will get printed just before the first solve. */
 extern PerfLog setup_perf_log;
 
+/**
+ * The performance graph timing the registered sections of the framework and the applications.
+ */
+extern PerfGraph perf_graph;
+
+/**
+ * The timing of the individual objects, off unless requested with --object-timing or --object-timing-csv.
+ */
+extern ObjectTiming object_timing;
+
 /**
  * Variable indicating whether we will enable FPE trapping for this run.
  */
@@ -43,6 +43,11 @@ class InputParameterWarehouse;
 class SystemInfo;
 class CommandLine;
 
+namespace libMesh
+{
+class MeshBase;
+}
+
 template<>
 InputParameters validParams<MooseApp>();
 
@@ -155,6 +160,28 @@ public:
    */
   Point getOutputPosition() { return _output_position; }
 
+  /**
+   * Give this App an already built mesh to copy instead of building its own.  This is
+   * used by MultiApps whose sub-apps all build the same mesh.
+   */
+  void setTemplateMesh(std::shared_ptr<const MeshBase> mesh) { _template_mesh = mesh; }
+
+  /**
+   * The mesh MooseMesh::init() will copy instead of building one (may be nullptr).
+   */
+  std::shared_ptr<const MeshBase> getTemplateMesh() const { return _template_mesh; }
+
+  /**
+   * Tell MooseMesh::init() to keep a copy of the mesh it builds so that it can be
+   * retrieved with getTemplateMesh() and handed to other Apps.
+   */
+  void captureTemplateMesh(bool state) { _capture_template_mesh = state; }
+
+  /**
+   * Whether or not MooseMesh::init() should keep a copy of the mesh it builds.
+   */
+  bool capturingTemplateMesh() const { return _capture_template_mesh; }
+
   /**
    * Set the starting time for the simulation.  This will override any choice
    * made in the input file.
@@ -254,6 +281,12 @@ public:
    */
   virtual void executeExecutioner();
 
+  /**
+   * Print the per object timing collected with --object-timing and write it to the requested
+   * CSV file, this is collective.
+   */
+  void outputObjectTiming();
+
   /**
    * Returns true if the user specified --distributed-mesh (or
    * --parallel-mesh, for backwards compatibility) on the command line
@@ -522,6 +555,12 @@ protected:
   /// The output position
   Point _output_position;
 
+  /// An identical, already built mesh to copy instead of building one
+  std::shared_ptr<const MeshBase> _template_mesh;
+
+  /// Whether or not to keep a copy of the mesh built by this App
+  bool _capture_template_mesh;
+
   /// Whether or not an start time has been set
   bool _start_time_set;
 
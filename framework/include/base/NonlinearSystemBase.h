@@ -247,6 +247,28 @@ public:
    */
   void computeJacobian(SparseMatrix<Number> & jacobian, Moose::KernelType kernel_type = Moose::KT_ALL);
 
+  /**
+   * Computes the residual and, in the same element loop, the element contributions (Kernels,
+   * IntegratedBCs, DGKernels and InterfaceKernels) to the Jacobian. \p jacobian is zeroed first
+   * and only holds the element contributions until a computeJacobian() call after
+   * useElementJacobian() adds the remaining ones.
+   * @param residual Residual is formed in here
+   * @param jacobian The Jacobian the element contributions are assembled into
+   */
+  void computeResidualAndJacobian(NumericVector<Number> & residual, SparseMatrix<Number> & jacobian);
+
+  /**
+   * Makes the next computeJacobian() call complete the Jacobian assembled by the last
+   * computeResidualAndJacobian() call instead of zeroing it and looping over the elements again.
+   */
+  void useElementJacobian() { _use_element_jacobian = true; }
+
+  /**
+   * Return the number of Jacobian evaluations that were completed from the element contributions
+   * assembled together with the residual
+   */
+  unsigned int nFusedJacobianEvaluations() const { return _n_fused_jacobian_evaluations; }
+
   /**
    * Computes several Jacobian blocks simultaneously, summing their contributions into smaller preconditioning matrices.
    *
@@ -658,6 +680,18 @@ protected:
   /// If there is a nodal BC having diag_save_in
   bool _has_nodalbc_diag_save_in;
 
+  /// The Jacobian the residual being computed also assembles the element contributions into (or nullptr)
+  SparseMatrix<Number> * _element_jacobian;
+
+  /// Whether the next Jacobian already holds the element contributions
+  bool _use_element_jacobian;
+
+  /// The number of Jacobian evaluations completed from the element contributions of a residual evaluation
+  unsigned int _n_fused_jacobian_evaluations;
+
+  /// Sets the PETSc options of the Jacobian matrix before it is assembled
+  void setJacobianOptions(SparseMatrix<Number> & jacobian);
+
   void getNodeDofs(dof_id_type node_id, std::vector<dof_id_type> & dofs);
 
   std::vector<dof_id_type> _var_all_dof_indices;
@@ -137,6 +137,25 @@ protected:
    */
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
+  /**
+   * Accumulates this BC's contribution for every test function at every face quadrature
+   * point into \p local_re. The default implementation calls computeQpResidual() once per
+   * (qp, i) pair; derived classes can override it to evaluate the whole side in one call.
+   */
+  virtual void computeResidualBatch(DenseVector<Number> & local_re);
+
+  /**
+   * Accumulates the on-diagonal Jacobian block for the current side into \p local_ke.
+   * @see computeResidualBatch()
+   */
+  virtual void computeJacobianBatch(DenseMatrix<Number> & local_ke);
+
+  /// Returns JxW * coord at each face quadrature point, for use in batched loops
+  const std::vector<Real> & batchWeights();
+
+private:
+  /// Storage for the quadrature weights returned by batchWeights()
+  std::vector<Real> _batch_weights;
 };
 
 #endif /* INTEGRATEDBC_H */
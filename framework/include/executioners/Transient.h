@@ -16,6 +16,7 @@
 #define TRANSIENT_H
 
 #include "Executioner.h"
+#include "PicardAcceleration.h"
 
 // System includes
 #include <string>
@@ -288,6 +289,18 @@ protected:
   Real _picard_rel_tol;
   Real _picard_abs_tol;
 
+  /// Relaxation/acceleration applied to the solution between Picard iterations
+  PicardAcceleration _picard_acceleration;
+
+  /// The solution going into the current Picard iteration
+  std::unique_ptr<NumericVector<Number> > _picard_iterate;
+
+  /// The Picard norm of each iteration of the current step
+  std::vector<Real> _picard_history;
+
+  /// Relaxes/accelerates the solution of the current Picard iteration
+  void accelerateSolution();
+
   ///should detailed diagnostic output be printed
   bool _verbose;
 
@@ -82,6 +82,13 @@ public:
    */
   Real maxPatchPercentage();
 
+  /**
+   * Largest NearestNodeLocator::maxSkinRatio() over all of the NearestNodeLocators.
+   *
+   * Once this exceeds the mesh's patch_skin_fraction the patches should be rebuilt.
+   */
+  Real maxSkinRatio();
+
 //protected:
   SubProblem & _subproblem;
   MooseMesh & _mesh;
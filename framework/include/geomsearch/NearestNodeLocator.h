@@ -18,6 +18,9 @@
 // Moose
 #include "Restartable.h"
 
+// libMesh
+#include "libmesh/point.h"
+
 // Forward declarations
 class SubProblem;
 class MooseMesh;
@@ -64,6 +67,12 @@ public:
    */
   NodeIdRange & slaveNodeRange() { return *_slave_node_range; }
 
+  /**
+   * The largest displacement of a slave node or patch node since the patch was built,
+   * divided by the smallest patch radius. Only computed for the "skin" patch update strategy.
+   */
+  Real maxSkinRatio() const { return _max_skin_ratio; }
+
   /**
    * Data structure used to hold nearest node info.
    */
@@ -77,6 +86,12 @@ public:
   };
 
 protected:
+  /// Records the node positions and patch radius used by the "skin" patch update strategy
+  void initSkinTracking();
+
+  /// Computes _max_skin_ratio from the current node positions
+  void updateSkinRatio();
+
   SubProblem & _subproblem;
 
   MooseMesh & _mesh;
@@ -99,6 +114,19 @@ public:
 
   // The furthest through the patch that had to be searched for any node last time
   Real _max_patch_percentage;
+
+protected:
+  /// Slave nodes and their patch nodes tracked by the "skin" patch update strategy
+  std::vector<dof_id_type> _skin_nodes;
+
+  /// Positions of _skin_nodes when the patch was built
+  std::vector<Point> _skin_reference_points;
+
+  /// Smallest distance from a slave node to the furthest node of its patch
+  Real _min_patch_radius;
+
+  /// See maxSkinRatio()
+  Real _max_skin_ratio;
 };
 
 #endif //NEARESTNODELOCATOR_H
@@ -24,11 +24,15 @@
 #include "libmesh/point.h"
 #include "libmesh/fe.h"
 
+// C++ includes
+#include <memory>
+
 // Forward Declarations
 class SubProblem;
 class MooseMesh;
 class GeometricSearchData;
 class NearestNodeLocator;
+class BoundingBoxTree;
 
 class PenetrationLocator : Restartable
 {
@@ -82,6 +86,23 @@ public:
   void setNormalSmoothingMethod(std::string nsmString);
   Real getTangentialTolerance() {return _tangential_tolerance;}
 
+  /**
+   * Only project slave nodes onto master sides whose bounding box, inflated by
+   * this distance, contains the node. Slave nodes further than this from every
+   * candidate side get no PenetrationInfo. By default every candidate side is used.
+   */
+  void setSearchDistance(Real search_distance);
+
+  /**
+   * Number of contact point projections performed for \p node_id during the last search.
+   */
+  unsigned int numProjections(dof_id_type node_id) const;
+
+  /**
+   * Total number of contact point projections performed during the last search.
+   */
+  unsigned long int totalProjections() const;
+
 protected:
   /// Check whether found candidates are reasonable
   bool _check_whether_reasonable;
@@ -90,6 +111,24 @@ protected:
   bool _do_normal_smoothing;  // Should we do contact normal smoothing?
   Real _normal_smoothing_distance; // Distance from edge (in parametric coords) within which to perform normal smoothing
   NORMAL_SMOOTHING_METHOD _normal_smoothing_method;
+
+  /// Gathers the master boundary sides and builds or refits _master_side_tree
+  void updateMasterSides();
+
+  /// Inflation of the master side bounding boxes (see setSearchDistance())
+  Real _search_distance;
+
+  /// The sides of each element that are on the master boundary
+  std::map<dof_id_type, std::vector<unsigned int> > _master_elem_sides;
+
+  /// All (element, side) pairs on the master boundary
+  std::vector<std::pair<dof_id_type, unsigned int> > _master_sides;
+
+  /// Bounding volume hierarchy over the inflated master sides (only built when a search distance is set)
+  std::unique_ptr<BoundingBoxTree> _master_side_tree;
+
+  /// Number of contact point projections for each slave node during the last search, sorted by node id
+  std::vector<std::pair<dof_id_type, unsigned int> > _num_projections;
 };
 
 /**
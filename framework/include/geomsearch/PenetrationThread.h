@@ -21,6 +21,7 @@
 
 // Forward declarations
 class MooseVariable;
+class BoundingBoxTree;
 
 class PenetrationThread
 {
@@ -41,9 +42,9 @@ public:
                     FEType & fe_type,
                     NearestNodeLocator & nearest_node,
                     const std::map<dof_id_type, std::vector<dof_id_type> > & node_to_elem_map,
-                    std::vector<dof_id_type> & elem_list,
-                    std::vector<unsigned short int> & side_list,
-                    std::vector<boundary_id_type> & id_list);
+                    const std::map<dof_id_type, std::vector<unsigned int> > & master_elem_sides,
+                    const std::vector<std::pair<dof_id_type, unsigned int> > & master_sides,
+                    const BoundingBoxTree * master_side_tree);
 
   // Splitting Constructor
   PenetrationThread(PenetrationThread & x, Threads::split split);
@@ -52,6 +53,9 @@ public:
 
   void join(const PenetrationThread & other);
 
+  /// Number of contact point projections performed for each slave node searched by this thread
+  std::vector<std::pair<dof_id_type, unsigned int> > _num_projections;
+
 protected:
   SubProblem & _subproblem;
   // The Mesh
@@ -80,11 +84,20 @@ protected:
 
   const std::map<dof_id_type, std::vector<dof_id_type> > & _node_to_elem_map;
 
-  std::vector<dof_id_type> & _elem_list;
-  std::vector<unsigned short int> & _side_list;
-  std::vector<boundary_id_type> & _id_list;
+  /// The sides of each element that are on the master boundary
+  const std::map<dof_id_type, std::vector<unsigned int> > & _master_elem_sides;
+
+  /// All (element, side) pairs on the master boundary, in the order of the boxes in _master_side_tree
+  const std::vector<std::pair<dof_id_type, unsigned int> > & _master_sides;
+
+  /// Inflated boxes around the master sides, or NULL to project onto all candidate sides
+  const BoundingBoxTree * _master_side_tree;
 
-  unsigned int _n_elems;
+  /// Master sides whose inflated box contains the current slave node (sorted)
+  std::vector<std::pair<dof_id_type, unsigned int> > _candidate_sides;
+
+  /// Number of contact point projections performed for the current slave node
+  unsigned int _node_projections;
 
   THREAD_ID _tid;
 
@@ -182,6 +195,9 @@ protected:
   getSidesOnMasterBoundary(std::vector<unsigned int> &sides,
                            const Elem *const elem);
 
+  /// Whether the inflated box of a master side contains the current slave node (always true without a search distance)
+  bool isCandidateSide(const Elem * elem, unsigned int side) const;
+
   void
   computeSlip( FEBase & fe,
                PenetrationInfo & info );
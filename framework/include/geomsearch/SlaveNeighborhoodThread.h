@@ -20,12 +20,14 @@
 
 // Forward declarations
 class MooseMesh;
+class KDTree;
 
 class SlaveNeighborhoodThread
 {
 public:
   SlaveNeighborhoodThread(const MooseMesh & mesh,
                           const std::vector<dof_id_type> & trial_master_nodes,
+                          const KDTree & kd_tree,
                           const std::map<dof_id_type, std::vector<dof_id_type> > & node_to_elem_map,
                           const unsigned int patch_size);
 
@@ -53,6 +55,9 @@ protected:
   /// Nodes to search against
   const std::vector<dof_id_type> & _trial_master_nodes;
 
+  /// Spatial index over the positions of _trial_master_nodes
+  const KDTree & _kd_tree;
+
   /// Node to elem map
   const std::map<dof_id_type, std::vector<dof_id_type> > & _node_to_elem_map;
 
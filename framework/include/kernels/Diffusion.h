@@ -31,10 +31,23 @@ class Diffusion : public Kernel
 public:
   Diffusion(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
 protected:
   virtual Real computeQpResidual() override;
 
   virtual Real computeQpJacobian() override;
+
+  virtual void computeResidualBatch(DenseVector<Number> & local_re) override;
+
+  virtual void computeJacobianBatch(DenseMatrix<Number> & local_ke) override;
+
+  /**
+   * Whether computeResidualBatch() and computeJacobianBatch() evaluate the Laplacian directly
+   * instead of calling computeQpResidual() and computeQpJacobian(). This is always the case for
+   * Diffusion itself; derived classes that keep its integrand can set it in their constructor.
+   */
+  bool _batched_loops;
 };
 
 
@@ -43,6 +43,28 @@ protected:
   /// This is the virtual that derived classes should override for computing an off-diagonal Jacobian component.
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
+  /**
+   * Accumulates this Kernel's contribution for every test function at every quadrature
+   * point of the current element into \p local_re. The default implementation calls
+   * computeQpResidual() once per (i, qp) pair. Kernels can override this to evaluate the
+   * whole element in one call using loops over the contiguous test function and solution
+   * arrays, which removes the per-point virtual dispatch and lets the compiler vectorize.
+   */
+  virtual void computeResidualBatch(DenseVector<Number> & local_re);
+
+  /**
+   * Accumulates the on-diagonal Jacobian block for the current element into \p local_ke.
+   * The default implementation calls computeQpJacobian() once per (i, j, qp) triple.
+   * @see computeResidualBatch()
+   */
+  virtual void computeJacobianBatch(DenseMatrix<Number> & local_ke);
+
+  /**
+   * Returns JxW * coord at each quadrature point of the current element, for use
+   * in batched residual and Jacobian loops.
+   */
+  const std::vector<Real> & batchWeights();
+
   /// Following methods are used for Kernels that need to perform a per-element calculation
   virtual void precalculateResidual();
   virtual void precalculateJacobian() {}
@@ -59,6 +81,10 @@ protected:
 
   /// Derivative of u_dot with respect to u
   const VariableValue & _du_dot_du;
+
+private:
+  /// Storage for the quadrature weights returned by batchWeights()
+  std::vector<Real> _batch_weights;
 };
 
 #endif /* KERNEL_H */
@@ -40,13 +40,13 @@ public:
    */
   KernelGrad(const InputParameters & parameters);
 
-  virtual void computeResidual() override;
-
-  virtual void computeJacobian() override;
-
   virtual void computeOffDiagJacobian(unsigned int jvar) override;
 
 protected:
+  virtual void computeResidualBatch(DenseVector<Number> & local_re) override;
+
+  virtual void computeJacobianBatch(DenseMatrix<Number> & local_ke) override;
+
   /**
    * Called before forming the residual for an element
    */
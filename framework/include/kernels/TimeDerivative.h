@@ -28,13 +28,25 @@ class TimeDerivative : public TimeKernel
 public:
   TimeDerivative(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
   virtual void computeJacobian() override;
 
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
 
+  virtual void computeResidualBatch(DenseVector<Number> & local_re) override;
+  virtual void computeJacobianBatch(DenseMatrix<Number> & local_ke) override;
+
   bool _lumping;
+
+  /**
+   * Whether computeResidualBatch() and computeJacobianBatch() evaluate the mass term directly
+   * instead of calling computeQpResidual() and computeQpJacobian(). This is always the case for
+   * TimeDerivative itself; derived classes that keep its integrand can set it in their constructor.
+   */
+  bool _batched_loops;
 };
 
 #endif //TIMEDERIVATIVE_H
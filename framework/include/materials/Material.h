@@ -159,6 +159,22 @@ public:
   const std::set<std::string> &
   getSuppliedItems() override { return _supplied_props; }
 
+  /**
+   * Return the ids of the properties declared by this material
+   */
+  const std::set<unsigned int> & getSuppliedPropIDs() const { return _supplied_prop_ids; }
+
+  /**
+   * Return the ids of the properties retrieved by this material with getMaterialProperty[Old/Older]
+   */
+  const std::set<unsigned int> & getRequestedPropIDs() const { return _requested_prop_ids; }
+
+  /**
+   * Returns true if any of the properties declared by this material are stateful,
+   * including those promoted to stateful by other objects requesting their old values
+   */
+  bool hasStatefulSuppliedProperties() const;
+
   void checkStatefulSanity() const;
 
   /**
@@ -172,6 +188,12 @@ public:
    */
   bool isBoundaryMaterial() const { return _bnd; }
 
+  /**
+   * Returns true if the values of this material may be reused between a residual and
+   * a Jacobian evaluation at the same solution
+   */
+  bool isCacheable() const { return _cacheable; }
+
 protected:
 
   /**
@@ -238,6 +260,10 @@ protected:
   /// the name strings each time.
   std::set<unsigned int> _supplied_prop_ids;
 
+  /// The ids of the properties retrieved by this material, used to determine which
+  /// materials have to be computed to supply the properties other objects need
+  std::set<unsigned int> _requested_prop_ids;
+
   /// If False MOOSE does not compute this property
   const bool _compute;
 
@@ -246,6 +272,12 @@ protected:
   /// that value around to all the qps.
   const bool _constant_on_elem;
 
+  /// True by default.  If true, the values computed by this material during a residual
+  /// evaluation may be reused by a Jacobian evaluation at the same solution (see the
+  /// "cache_materials" Problem parameter).  Materials that compute different values
+  /// while computing the Jacobian must set this to false.
+  bool _cacheable;
+
   enum QP_Data_Type {
     CURR,
     PREV
@@ -331,7 +363,9 @@ Material::getMaterialPropertyByName(const std::string & prop_name)
   _requested_props.insert(prop_name);
   registerPropName(prop_name, true, Material::CURRENT);
   _fe_problem.markMatPropRequested(prop_name);
-  return _material_data->getProperty<T>(prop_name);
+  const MaterialProperty<T> & prop = _material_data->getProperty<T>(prop_name);
+  _requested_prop_ids.insert(_material_data->getPropertyId(prop_name));
+  return prop;
 }
 
 template<typename T>
@@ -341,7 +375,9 @@ Material::getMaterialPropertyOldByName(const std::string & prop_name)
   _requested_props.insert(prop_name);
   registerPropName(prop_name, true, Material::OLD);
   _fe_problem.markMatPropRequested(prop_name);
-  return _material_data->getPropertyOld<T>(prop_name);
+  const MaterialProperty<T> & prop = _material_data->getPropertyOld<T>(prop_name);
+  _requested_prop_ids.insert(_material_data->getPropertyId(prop_name));
+  return prop;
 }
 
 template<typename T>
@@ -351,7 +387,9 @@ Material::getMaterialPropertyOlderByName(const std::string & prop_name)
   _requested_props.insert(prop_name);
   registerPropName(prop_name, true, Material::OLDER);
   _fe_problem.markMatPropRequested(prop_name);
-  return _material_data->getPropertyOlder<T>(prop_name);
+  const MaterialProperty<T> & prop = _material_data->getPropertyOlder<T>(prop_name);
+  _requested_prop_ids.insert(_material_data->getPropertyId(prop_name));
+  return prop;
 }
 
 
@@ -23,8 +23,10 @@
 #include "libmesh/elem.h"
 
 #include <vector>
+#include <memory>
 
 class Material;
+class MaterialPropertyCache;
 
 /**
  * Proxy for accessing MaterialPropertyStorage.
@@ -52,6 +54,24 @@ public:
    */
   unsigned int nQPoints();
 
+  /**
+   * Moves the values of all properties that are not stateful into one contiguous block where
+   * each property gets a cache line aligned slice for \p max_qpoints quadrature points, so that
+   * resize() does not allocate for them anymore.  Call this once all the properties are declared
+   * and all the stateful ones are known.
+   */
+  void allocateArena(unsigned int max_qpoints);
+
+  /**
+   * Moves the arena properties back to their own memory and frees the arena.
+   */
+  void releaseArena();
+
+  /**
+   * The number of quadrature points the arena holds (0 when there is no arena).
+   */
+  unsigned int arenaQPoints() const { return _arena_qpoints; }
+
   /**
    * Declare the Real valued property named "name".
    * Calling any of the declareProperty
@@ -82,6 +102,13 @@ public:
   /// Reinit material properties for given element (and possible side)
   void reinit(const std::vector<std::shared_ptr<Material>> & mats);
 
+  /**
+   * Reinit material properties for the element \p elem_id, reusing values from \p cache.
+   * When \p restore is true the values of the cacheable materials are restored from the cache
+   * (and computed only when not found), otherwise they are computed and stored into the cache.
+   */
+  void reinit(const std::vector<std::shared_ptr<Material>> & mats, MaterialPropertyCache & cache, dof_id_type elem_id, bool restore);
+
   /// Calls the reset method of Materials to ensure that they are in a proper state.
   void reset(const std::vector<std::shared_ptr<Material>> & mats);
 
@@ -164,6 +191,15 @@ protected:
   /// Status of storage swapping (calling swap sets this to true; swapBack sets it to false)
   bool _swapped;
 
+  /// Memory for the property values in the arena
+  std::unique_ptr<char[]> _arena;
+
+  /// The number of quadrature points the arena holds
+  unsigned int _arena_qpoints;
+
+  /// The properties stored in the arena
+  std::vector<PropertyValue *> _arena_props;
+
 private:
   template<typename T>
   MaterialProperty<T> & declareHelper(MaterialProperties& props, const std::string & prop_name, unsigned int prop_id);
@@ -16,6 +16,8 @@
 #define MATERIALPROPERTY_H
 
 #include <vector>
+#include <new>
+#include <algorithm>
 
 #include "MooseArray.h"
 #include "ColumnMajorMatrix.h"
@@ -78,6 +80,22 @@ public:
   // save/restore in a file
   virtual void store(std::ostream & stream) = 0;
   virtual void load(std::istream & stream) = 0;
+
+  /**
+   * The number of bytes one quadrature point value needs in an arena (see MaterialData::allocateArena())
+   */
+  virtual std::size_t valueBytes() const = 0;
+
+  /**
+   * Moves the values into arena memory for \p capacity quadrature points starting at \p data
+   * (suitably aligned, not owned by the property).
+   */
+  virtual void attachArena(void * data, unsigned int capacity) = 0;
+
+  /**
+   * Moves the values out of the arena, back into memory owned by the property.
+   */
+  virtual void detachArena() = 0;
 };
 
 template<>
@@ -104,11 +122,12 @@ class MaterialProperty : public PropertyValue
 {
 public:
   /// Explicitly declare a public constructor because we made the copy constructor private
-  MaterialProperty() : PropertyValue() { /* */ }
+  MaterialProperty() : PropertyValue(), _arena(nullptr), _arena_capacity(0) { /* */ }
 
   virtual ~MaterialProperty()
   {
     _value.release();
+    destroyArena();
   }
 
   /**
@@ -172,6 +191,12 @@ public:
    */
   virtual void load(std::istream & stream);
 
+  virtual std::size_t valueBytes() const { return sizeof(T); }
+
+  virtual void attachArena(void * data, unsigned int capacity);
+
+  virtual void detachArena();
+
   /**
    * Friend helper function to handle scalar material property initializations
    * @param size - the size corresponding to the quadrature rule
@@ -198,8 +223,17 @@ private:
   /// private assignment operator to avoid shallow copying of material properties
   MaterialProperty<T> & operator = (const MaterialProperty<T> & /*rhs*/) { mooseError("Material properties must be assigned to references (missing '&')"); }
 
+  /// Destroys the values constructed in the arena (the memory belongs to the MaterialData)
+  void destroyArena();
+
   /// Stored parameter value.
   MooseArray<T> _value;
+
+  /// The arena values (if any), _value points here until it needs to grow past _arena_capacity
+  T * _arena;
+
+  /// The number of values constructed in the arena
+  unsigned int _arena_capacity;
 };
 
 
@@ -246,16 +280,65 @@ template<typename T>
 inline void
 MaterialProperty<T>::store(std::ostream & stream)
 {
-  for (unsigned int i = 0; i < _value.size(); i++)
-    storeHelper(stream, _value[i], NULL);
+  if (_value.size())
+    storeContiguous(stream, &_value[0], _value.size(), NULL);
 }
 
 template<typename T>
 inline void
 MaterialProperty<T>::load(std::istream & stream)
 {
-  for (unsigned int i = 0; i < _value.size(); i++)
-    loadHelper(stream, _value[i], NULL);
+  if (_value.size())
+    loadContiguous(stream, &_value[0], _value.size(), NULL);
+}
+
+template<typename T>
+inline void
+MaterialProperty<T>::attachArena(void * data, unsigned int capacity)
+{
+  T * arena = static_cast<T *>(data);
+  for (unsigned int i = 0; i < capacity; i++)
+    new (arena + i) T();
+
+  for (unsigned int i = 0; i < std::min(_value.size(), capacity); i++)
+    arena[i] = _value[i];
+
+  _value.attach(arena, capacity);
+
+  destroyArena();
+  _arena = arena;
+  _arena_capacity = capacity;
+}
+
+template<typename T>
+inline void
+MaterialProperty<T>::detachArena()
+{
+  if (_arena == nullptr)
+    return;
+
+  if (_value.isExternal())
+  {
+    MooseArray<T> owned(_value.size());
+    for (unsigned int i = 0; i < _value.size(); i++)
+      owned[i] = _value[i];
+
+    _value.release();
+    _value.swap(owned);
+  }
+
+  destroyArena();
+}
+
+template<typename T>
+inline void
+MaterialProperty<T>::destroyArena()
+{
+  for (unsigned int i = 0; i < _arena_capacity; i++)
+    _arena[i].~T();
+
+  _arena = nullptr;
+  _arena_capacity = 0;
 }
 
 /**
@@ -0,0 +1,105 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MATERIALPROPERTYCACHE_H
+#define MATERIALPROPERTYCACHE_H
+
+#include "MooseTypes.h"
+
+// C++ includes
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+class MaterialProperties;
+class PropertyValue;
+
+/**
+ * Keeps copies of material property values per element so that an evaluation at the same
+ * solution state can reuse them instead of computing the materials again.
+ *
+ * Values stored before the last call to newState() are stale and never restored, but their
+ * memory is kept and reused for the values of the next state.  Once the configured amount of
+ * memory is in use, values for elements that are not in the cache yet are not stored anymore.
+ */
+class MaterialPropertyCache
+{
+public:
+  MaterialPropertyCache();
+  virtual ~MaterialPropertyCache();
+
+  /**
+   * Invalidates all the stored values
+   */
+  void newState() { ++_state; }
+
+  /**
+   * Frees all the stored values
+   */
+  void clear();
+
+  /**
+   * Sets the (approximate) number of bytes the stored values may use
+   */
+  void setMaxBytes(std::size_t max_bytes) { _max_bytes = max_bytes; }
+
+  /**
+   * The (approximate) number of bytes the stored values use
+   */
+  std::size_t bytes() const { return _bytes; }
+
+  /**
+   * The number of times the values on an element were restored
+   */
+  unsigned long nRestores() const { return _n_restores; }
+
+  /**
+   * Copies the values of the properties \p prop_ids on the element \p elem_id from \p props
+   * @return false if there was not enough memory left to store them
+   */
+  bool store(dof_id_type elem_id, const std::set<unsigned int> & prop_ids, MaterialProperties & props, unsigned int n_qpoints);
+
+  /**
+   * Copies the values of the properties \p prop_ids on the element \p elem_id into \p props
+   * @return false (and leaves \p props untouched) unless all of them were stored in the current state
+   */
+  bool restore(dof_id_type elem_id, const std::set<unsigned int> & prop_ids, MaterialProperties & props, unsigned int n_qpoints);
+
+protected:
+  struct Entry
+  {
+    /// The values indexed by the property id (nullptr if never stored)
+    std::vector<PropertyValue *> _values;
+
+    /// The state in which each value was stored
+    std::vector<unsigned int> _states;
+  };
+
+  /// The stored values for each element
+  std::unordered_map<dof_id_type, Entry> _entries;
+
+  /// The current state, values stored with a different state are stale (0 is never current)
+  unsigned int _state;
+
+  /// The memory used by the values
+  std::size_t _bytes;
+
+  /// The memory the values may use
+  std::size_t _max_bytes;
+
+  /// Counts the successful calls to restore()
+  unsigned long _n_restores;
+};
+
+#endif // MATERIALPROPERTYCACHE_H
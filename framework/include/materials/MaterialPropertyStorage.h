@@ -19,6 +19,9 @@
 #include "MaterialProperty.h"
 #include "HashMap.h"
 
+// C++ includes
+#include <array>
+
 // Forward declarations
 class Material;
 class MaterialData;
@@ -33,7 +36,7 @@ class QBase;
 /**
  * Stores the stateful material properties computed by materials.
  *
- * Thread-safe
+ * Thread-safe (swap() and swapBack() of elements indexed by buildSlots() do not need a lock)
  */
 class MaterialPropertyStorage
 {
@@ -151,6 +154,18 @@ public:
    */
   void swapBack(MaterialData & material_data, const Elem & elem, unsigned int side);
 
+  /**
+   * Builds the dense (element id, side) index of the stored properties used by swap() and
+   * swapBack().  Entries found in the index are swapped without a hash lookup and without taking
+   * the global lock; everything else falls back to the HashMap.  Call this after storage was
+   * created for new elements (initial stateful properties, mesh changes, restart).
+   * Not thread safe.
+   */
+  void buildSlots();
+
+  /// Removes the dense index, all swaps go through the HashMap until buildSlots() is called again
+  void clearSlots();
+
   /**
    * @return a Boolean indicating whether stateful properties exist on this material
    */
@@ -226,6 +241,24 @@ protected:
 
   void sizeProps(MaterialProperties & mp, unsigned int size);
 
+  /// The stored properties of one (element, side) in the three (physical) state maps
+  typedef std::array<MaterialProperties *, 3> Slot;
+
+  /// Returns the slot of (elem, side) or nullptr when it is not in the dense index
+  const Slot * findSlot(const Elem & elem, unsigned int side) const;
+
+  /// The slots of the element with id _slot_first_id + i are _slots[_elem_slot_begin[i] + side]
+  /// for side < _elem_slot_begin[i + 1] - _elem_slot_begin[i].  Only the id range of the elements
+  /// stored on this processor is indexed (their ids are contiguous on a distributed mesh).
+  dof_id_type _slot_first_id;
+  std::vector<std::size_t> _elem_slot_begin;
+  /// The element each id referred to when the index was built (guards against stale ids)
+  std::vector<const Elem *> _slot_elems;
+  /// Pointers into the three state maps, indexed by physical state
+  std::vector<Slot> _slots;
+  /// The physical state holding the current/old/older properties (rotated by shift())
+  std::array<unsigned int, 3> _slot_state;
+
 private:
   /// Initializes hashmap entries for element and side to proper qpoint and
   /// property count sizes.
@@ -252,6 +285,8 @@ dataLoad(std::istream & stream, MaterialPropertyStorage & storage, void * contex
 
   if (storage.hasOlderProperties())
     dataLoad(stream, storage.propsOlder(), context);
+
+  storage.buildSlots();
 }
 
 
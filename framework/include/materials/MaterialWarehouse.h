@@ -51,6 +51,24 @@ public:
    */
   void addObjects(std::shared_ptr<Material> block, std::shared_ptr<Material> neighbor, std::shared_ptr<Material> face, THREAD_ID tid = 0);
 
+  /**
+   * Collects the active block materials that have to be computed to supply the given material
+   * properties, including the properties those materials request in turn.
+   *
+   * Materials that declare no properties or that declare stateful properties are always
+   * included. The materials are returned in the same (dependency resolved) order as
+   * getActiveBlockObjects().
+   *
+   * @param id The subdomain
+   * @param needed_mat_props The ids of the material properties required by the consuming objects
+   * @param needed_materials The materials to compute (output)
+   * @param tid The thread id
+   */
+  void getNeededBlockObjects(SubdomainID id,
+                             const std::set<unsigned int> & needed_mat_props,
+                             std::vector<std::shared_ptr<Material>> & needed_materials,
+                             THREAD_ID tid = 0) const;
+
 protected:
   /// Stroage for neighbor material objects (Block are stored in the base class)
   MooseObjectWarehouse<Material> _neighbor_materials;
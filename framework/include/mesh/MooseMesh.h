@@ -107,6 +107,13 @@ public:
    */
   virtual void buildMesh() = 0;
 
+  /**
+   * Fills in the (empty) libMesh mesh with a copy of the nodes, elements, and boundary
+   * information of an identical, already built mesh.  This is used in place of buildMesh()
+   * by sub-apps that don't read their mesh again (see the MultiApp "reuse_mesh" parameter).
+   */
+  void copyTemplateMesh(const MeshBase & template_mesh);
+
   /**
    * Returns MeshBase::mesh_dimsension(), (not
    * MeshBase::spatial_dimension()!) of the underlying libMesh mesh
@@ -452,6 +459,12 @@ public:
    */
   const MooseEnum & getPatchUpdateStrategy() const;
 
+  /**
+   * Get the fraction of the patch radius nodes may move before the patch
+   * is rebuilt with the "skin" update strategy.
+   */
+  Real getPatchSkinFraction() const;
+
   /**
    * Get a (slightly inflated) processor bounding box.
    *
@@ -943,6 +956,9 @@ protected:
   /// The patch update strategy
   MooseEnum _patch_update_strategy;
 
+  /// Fraction of the patch radius nodes may move before a "skin" patch update
+  Real _patch_skin_fraction;
+
   /// file_name iff this mesh was read from a file
   std::string _file_name;
 
@@ -18,6 +18,9 @@
 #include "SetupInterface.h"
 #include "Restartable.h"
 
+// C++ includes
+#include <limits>
+
 class MultiApp;
 class UserObject;
 class FEProblemBase;
@@ -31,6 +34,7 @@ namespace libMesh
 {
 namespace MeshTools { class BoundingBox; }
 template <typename T> class NumericVector;
+class MeshBase;
 }
 
 template<>
@@ -40,7 +44,17 @@ InputParameters validParams<MultiApp>();
  * Helper class for holding Sub-app backups
  */
 class SubAppBackups : public std::vector<std::shared_ptr<Backup>>
-{};
+{
+public:
+  /**
+   * Written ahead of the layout version.  Files written before the layout was versioned start
+   * with the size of the system data of the first Backup (or nothing at all), never this value.
+   */
+  static constexpr std::size_t format_marker = std::numeric_limits<std::size_t>::max();
+
+  /// Version 1 stores the App distribution ahead of the Backups
+  static constexpr unsigned int format_version = 1;
+};
 
 /**
  * A MultiApp represents one or more MOOSE applications that are running simultaneously.
@@ -103,6 +117,32 @@ public:
    */
   virtual void restore();
 
+  /**
+   * Redistribute the Apps among the processors to even out their cost.
+   *
+   * Called at the beginning of each time step, before backup().
+   */
+  virtual void loadBalance() {}
+
+  /**
+   * The number of times the Apps were moved between processors.  Objects that
+   * cache information about where the Apps live can compare this to detect changes.
+   */
+  unsigned int numRedistributions() const { return _num_redistributions; }
+
+  /**
+   * The number of local Apps that started from a copy of the mesh of another App (see "reuse_mesh").
+   */
+  unsigned int numReusedMeshes() const { return _num_reused_meshes; }
+
+  /**
+   * Make this processor own the global Apps [first_local_app, first_local_app + num_local_apps),
+   * the distribution stored with the Backups that are being loaded.  Before initialSetup() this
+   * only changes which Apps get created, afterwards the Apps that are no longer local are deleted
+   * and the new ones are created.  Their state comes from the Backups loaded next.
+   */
+  void restoreLocalApps(unsigned int first_local_app, unsigned int num_local_apps);
+
   /**
    * Whether or not this MultiApp should be restored at the beginning of
    * each Picard iteration.
@@ -284,6 +324,28 @@ protected:
   /// call back executed right before app->runInputFile()
   virtual void preRunInputFile();
 
+  /// Create all of the local Apps (called by initialSetup())
+  void createApps();
+
+  /**
+   * Move Apps between processors so that processor p owns the global Apps
+   * [first_apps[p], first_apps[p+1]).  Apps leaving a processor are backed up
+   * and sent to their new processor, where they are created and restored from
+   * that Backup.  Only valid when each processor owns whole Apps.
+   *
+   * @param first_apps The first global App of every processor followed by the total number of Apps
+   */
+  void redistributeApps(const std::vector<unsigned int> & first_apps);
+
+  /**
+   * Called by redistributeApps() after the local Apps have been renumbered.
+   * The Apps that moved to this processor have been created but their state
+   * has not been restored yet.
+   *
+   * @param created Whether or not each local App was created by the redistribution
+   */
+  virtual void setupRedistributedApps(const std::vector<bool> & created);
+
   /// The FEProblemBase this MultiApp is part of
   FEProblemBase & _fe_problem;
 
@@ -338,6 +400,15 @@ protected:
   /// Whether or not to move the output of the MultiApp into position
   bool _output_in_position;
 
+  /// Whether or not Apps with the same input file start from a copy of the same mesh
+  bool _reuse_mesh;
+
+  /// The first mesh built on this processor for each input file (used with _reuse_mesh during initialSetup())
+  std::map<std::string, std::shared_ptr<const MeshBase> > _template_meshes;
+
+  /// The number of local Apps that started from a copy of another App's mesh
+  unsigned int _num_reused_meshes;
+
   /// The time at which to reset apps
   Real _reset_time;
 
@@ -362,6 +433,9 @@ protected:
   /// Whether or not this processor as an App _at all_
   bool _has_an_app;
 
+  /// The number of times the Apps were moved between processors
+  unsigned int _num_redistributions;
+
   /// Backups for each local App
   SubAppBackups & _backups;
 };
@@ -377,6 +451,17 @@ dataStore(std::ostream & stream, SubAppBackups & backups, void * context)
   if (!multi_app)
     mooseError("Error storing std::vector<Backup*>");
 
+  std::size_t format_marker = SubAppBackups::format_marker;
+  unsigned int format_version = SubAppBackups::format_version;
+  dataStore(stream, format_marker, context);
+  dataStore(stream, format_version, context);
+
+  // The Apps may have been redistributed since they were created
+  unsigned int first_local_app = multi_app->firstLocalApp();
+  unsigned int num_local_apps = multi_app->numLocalApps();
+  dataStore(stream, first_local_app, context);
+  dataStore(stream, num_local_apps, context);
+
   for (unsigned int i=0; i<backups.size(); i++)
     dataStore(stream, backups[i], context);
 }
@@ -390,6 +475,31 @@ dataLoad(std::istream & stream, SubAppBackups & backups, void * context)
   if (!multi_app)
     mooseError("Error loading std::vector<Backup*>");
 
+  std::streampos start = stream.tellg();
+  std::size_t format_marker = 0;
+  dataLoad(stream, format_marker, context);
+
+  if (format_marker == SubAppBackups::format_marker)
+  {
+    unsigned int format_version = 0;
+    dataLoad(stream, format_version, context);
+    if (format_version > SubAppBackups::format_version)
+      mooseError("The sub-app backups of ", multi_app->name(), " were written with a newer version of MOOSE");
+
+    unsigned int first_local_app = 0;
+    unsigned int num_local_apps = 0;
+    dataLoad(stream, first_local_app, context);
+    dataLoad(stream, num_local_apps, context);
+
+    multi_app->restoreLocalApps(first_local_app, num_local_apps);
+  }
+  else
+  {
+    // The old layout only holds the Backups, the Apps were never redistributed
+    stream.clear();
+    stream.seekg(start);
+  }
+
   for (unsigned int i=0; i<backups.size(); i++)
     dataLoad(stream, backups[i], context);
 
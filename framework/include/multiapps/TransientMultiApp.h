@@ -48,6 +48,8 @@ public:
 
   virtual void resetApp(unsigned int global_app, Real time) override;
 
+  virtual void loadBalance() override;
+
   /**
    * Finds the smallest dt from among any of the apps.
    */
@@ -62,6 +64,8 @@ private:
    */
   void setupApp(unsigned int i, Real time = 0.0);
 
+  virtual void setupRedistributedApps(const std::vector<bool> & created) override;
+
   std::vector<Transient *> _transient_executioners;
 
   bool _sub_cycling;
@@ -95,6 +99,18 @@ private:
 
   /// Flag for toggling console output on sub cycles
   bool _print_sub_cycles;
+
+  /// Whether or not to redistribute the Apps based on their solve times
+  bool _load_balance;
+
+  /// Relative load imbalance tolerated before the Apps are redistributed
+  Real _load_balance_tolerance;
+
+  /// The wall time spent solving each local App since the last load balance
+  std::vector<Real> _app_solve_times;
+
+  /// Whether or not to report the imbalance measured after the last redistribution
+  bool _report_imbalance;
 };
 
 /**
@@ -89,6 +89,9 @@ private:
   bool _set_delimiter;
   std::string _delimiter;
 
+  /// Append the new rows instead of rewriting the files
+  bool _streaming;
+
   /// Flag for writting scalar and/or postprocessor data
   bool _write_all_table;
 
@@ -20,7 +20,9 @@
 #include "FileOutput.h"
 #include "RestartableDataIO.h"
 
-#include <deque>
+#include <list>
+#include <set>
+#include <future>
 
 // Forward declarations
 class Checkpoint;
@@ -42,8 +44,17 @@ struct CheckpointFileNames
 
   /// Filename for restartable data filename
   std::string restart;
+
+  /// Filename of the marker written once every processor wrote all of the files above
+  std::string complete;
+
+  /// Restartable data filenames of earlier checkpoints this (incremental) checkpoint refers to
+  std::set<std::string> restart_dependencies;
 };
 
+template<> void dataStore(std::ostream & stream, CheckpointFileNames & file_struct, void * context);
+template<> void dataLoad(std::istream & stream, CheckpointFileNames & file_struct, void * context);
+
 /**
  *
  */
@@ -57,12 +68,23 @@ public:
    */
   Checkpoint(const InputParameters & parameters);
 
+  /**
+   * Class destructor, waits for a checkpoint that is still being written.  That checkpoint is
+   * not marked as complete (this is not a collective operation), recovery uses the one before.
+   */
+  virtual ~Checkpoint();
+
   /**
    * Outputs a checkpoint file.
    * Each call to this function creates various files associated with
    */
   void output(const ExecFlagType & type) override;
 
+  /**
+   * Completes the checkpoint still being written before the final output
+   */
+  virtual void outputStep(const ExecFlagType & type) override;
+
   /**
    * Returns the base filename for the checkpoint files
    */
@@ -78,6 +100,33 @@ protected:
 
   void updateCheckpointFiles(CheckpointFileNames file_struct);
 
+  /**
+   * Waits until the restartable data of the previous asynchronous checkpoint is written and completes it
+   */
+  void waitForPendingWrite();
+
+  /**
+   * Marks the checkpoint as complete once every processor wrote its files (collective),
+   * then removes the checkpoints that are not needed anymore
+   */
+  void completeCheckpoint(const CheckpointFileNames & file_struct);
+
+  /**
+   * After a recover, takes over the stored checkpoints of the run that wrote the recovered
+   * checkpoint, so that they are removed like the ones written by this run
+   */
+  void adoptRecoveredCheckpoint();
+
+  /**
+   * Whether a stored checkpoint refers to the restartable data files with base name \p restart
+   */
+  bool restartFilesReferenced(const std::string & restart) const;
+
+  /**
+   * Removes the restartable data files with base name \p restart
+   */
+  void removeRestartFiles(const std::string & restart);
+
 private:
 
   /// Max no. of output files to store
@@ -92,6 +141,21 @@ private:
   /// True if running with parallel mesh
   bool _parallel_mesh;
 
+  /// True if the restartable data is written on a separate I/O thread
+  const bool _asynchronous;
+
+  /// The restartable data being written by the I/O thread
+  std::future<void> _pending_write;
+
+  /// The files of the checkpoint being written by the I/O thread
+  CheckpointFileNames _pending_file_struct;
+
+  /// True if the restartable data of all processors and threads is written into a single file
+  const bool _shared_restart_file;
+
+  /// True if only the restartable data that changed since the previous checkpoint is written
+  const bool _incremental;
+
   /// Reference to the restartable data
   const RestartableDatas & _restartable_data;
 
@@ -107,8 +171,17 @@ private:
   /// RestrableData input/output interface
   RestartableDataIO _restartable_data_io;
 
-  /// Vector of checkpoint filename structures
-  std::deque<CheckpointFileNames> _file_names;
+  /// List of checkpoint filename structures (recoverable)
+  std::list<CheckpointFileNames> & _file_names;
+
+  /// Restartable data files of removed checkpoints that stored checkpoints still refer to (recoverable)
+  std::list<std::string> & _referenced_restart_files;
+
+  /// The files of the last checkpoint, recovering restores the one being written
+  CheckpointFileNames & _last_file_struct;
+
+  /// True until the checkpoint this run recovered from is taken over
+  bool _adopt_recovered_checkpoint;
 };
 
 #endif //CHECKPOINT_H
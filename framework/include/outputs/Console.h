@@ -195,6 +195,10 @@ protected:
   /// State for the performance log header information
   bool _perf_header;
 
+  /// Files receiving the performance graph as JSON and as a Chrome trace at the end of the run
+  std::string _perf_graph_json;
+  std::string _perf_graph_trace;
+
   /// Flag for writing all variable norms
   bool _all_variable_norms;
 
@@ -221,6 +225,16 @@ private:
    */
   void mooseConsole(const std::string & message);
 
+  /**
+   * Returns the table of the performance graph
+   */
+  std::string perfGraphTable() const;
+
+  /**
+   * Write the performance graph to the JSON and trace files (processor 0 only)
+   */
+  void writePerfGraphFiles() const;
+
   /// State of the --timing command line argument from MooseApp
   bool _timing;
 
@@ -19,6 +19,9 @@
 #include "AdvancedOutput.h"
 #include "OversampleOutput.h"
 
+// C++ includes
+#include <future>
+
 // Forward declarations
 class Exodus;
 
@@ -43,6 +46,11 @@ public:
    */
   Exodus(const InputParameters & parameters);
 
+  /**
+   * Class destructor, waits for a timestep that is still being written
+   */
+  virtual ~Exodus();
+
   /**
    * Overload the OutputBase::output method, this is required for ExodusII
    * output due to the method utilized for outputing single/global parameters
@@ -143,6 +151,29 @@ private:
    */
   void outputEmptyTimestep();
 
+  /// The data of a timestep that is written on a separate thread
+  struct StagedTimestep
+  {
+    int timestep = 0;
+    Real time = 0;
+    std::vector<std::vector<Real> > nodal_values;
+    std::vector<std::string> elemental_names;
+    std::vector<Real> elemental_values;
+    std::vector<std::string> global_names;
+    std::vector<Real> global_values;
+    std::vector<std::string> information_records;
+  };
+
+  /**
+   * Appends a staged timestep to the initialized ExodusII file, this runs on the I/O thread
+   */
+  void writeStagedTimestep(StagedTimestep staged);
+
+  /**
+   * Waits until the timestep of the previous asynchronous output is written
+   */
+  void waitForPendingWrite();
+
   /// Count of outputs per exodus file
   unsigned int & _exodus_num;
 
@@ -160,6 +191,18 @@ private:
 
   /// Flag for overwriting timesteps
   bool _overwrite;
+
+  /// True if timesteps appended to an existing file are written on a separate I/O thread
+  const bool _asynchronous;
+
+  /// True while the data of the current output is being copied instead of written
+  bool _stage_output;
+
+  /// The data copied by the current output
+  StagedTimestep _staged_timestep;
+
+  /// The timestep being written by the I/O thread
+  std::future<void> _pending_write;
 };
 
 #endif /* EXODUS_H */
@@ -0,0 +1,162 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef XDMF_H
+#define XDMF_H
+
+// MOOSE includes
+#include "AdvancedOutput.h"
+#include "OversampleOutput.h"
+
+#include "libmesh/libmesh_config.h"
+
+#ifdef LIBMESH_HAVE_MPI
+#include <mpi.h>
+#endif
+
+// C++ includes
+#include <cstdint>
+#include <fstream>
+
+// Forward declarations
+class XDMF;
+
+// libMesh forward declarations
+namespace libMesh
+{
+class Node;
+class Elem;
+class System;
+}
+
+template<>
+InputParameters validParams<XDMF>();
+
+/**
+ * Class for output of the variables as raw binary arrays that all processors write into a single
+ * file per timestep with MPI-IO, together with an XDMF file describing them
+ *
+ * The nodal arrays are indexed by the node ids, so the connectivity is written without any
+ * communication. The elemental arrays hold the active elements ordered by processor. Without MPI
+ * the single processor writes the binary files with a std::ofstream.
+ */
+class XDMF : public AdvancedOutput<OversampleOutput>
+{
+public:
+
+  /**
+   * Class constructor
+   */
+  XDMF(const InputParameters & parameters);
+
+  /**
+   * Writes the binary file of the current timestep and updates the XDMF file
+   */
+  virtual void output(const ExecFlagType & type) override;
+
+  /**
+   * Set flag indicating that the mesh has changed
+   */
+  virtual void meshChanged() override;
+
+protected:
+
+  /**
+   * Writes the nodal variables, discontinuous variables above CONSTANT order are an error since
+   * they have no values at the nodes
+   */
+  virtual void outputNodalVariables() override;
+
+  /**
+   * Writes the constant monomial variables
+   */
+  virtual void outputElementalVariables() override;
+
+  /**
+   * Returns the name of the XDMF file
+   */
+  virtual std::string filename() override;
+
+  /**
+   * Returns the name of the binary file of the current timestep
+   */
+  std::string binaryFileName();
+
+private:
+
+  /**
+   * Writes the node coordinates and the connectivity, returns the XDMF description
+   */
+  std::string writeMesh();
+
+  /**
+   * Writes an array with n_comp values per node, placing the values of the local nodes at their ids
+   */
+  void writeNodalArray(const std::vector<Real> & values, unsigned int n_comp);
+
+  /**
+   * Writes an array where each processor holds a contiguous block
+   * @param local_offset The index of the first local value in the array
+   * @param total The size of the array
+   */
+  void writeBlockArray(const void * values, std::size_t count, std::size_t value_size, uint64_t local_offset, uint64_t total);
+
+  /**
+   * Returns the XDMF description of an array in the binary file starting at the given offset
+   */
+  std::string dataItem(const std::string & dimensions, const std::string & number_type, uint64_t offset);
+
+  /**
+   * Finds the system and the number of a variable
+   */
+  const System & getSystem(const std::string & var_name, unsigned int & var_num);
+
+  /// Adds the latest timestep to the XDMF file, the first call of a run writes all of them
+  void writeXDMF();
+
+  /// The XDMF descriptions of the timesteps written so far
+  std::vector<std::string> & _grids;
+
+  /// The position of the closing tags in the XDMF file, negative until the file is written
+  std::streamoff _xdmf_footer_pos;
+
+  /// True when the mesh has to be written with the next output
+  bool _write_mesh;
+
+  /// The XDMF description of the latest mesh written
+  std::string _mesh_xml;
+
+  /// The XDMF description of the variables of the current timestep
+  std::string _attributes_xml;
+
+  /// The binary file being written and the offset of the next array in it
+#ifdef LIBMESH_HAVE_MPI
+  MPI_File _fh;
+#else
+  std::ofstream _fh;
+#endif
+  std::string _binary_file_name;
+  uint64_t _offset;
+
+  /// The local nodes sorted by id and the number of entries in the nodal arrays
+  std::vector<const Node *> _local_nodes;
+  dof_id_type _n_node_slots;
+
+  /// The local active elements, the index of the first one and the total number of elements
+  std::vector<const Elem *> _local_elems;
+  uint64_t _elem_offset;
+  uint64_t _n_elems;
+};
+
+#endif /* XDMF_H */
@@ -0,0 +1,41 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef NUMFUSEDJACOBIANEVALUATIONS_H
+#define NUMFUSEDJACOBIANEVALUATIONS_H
+
+#include "GeneralPostprocessor.h"
+
+//Forward Declarations
+class NumFusedJacobianEvaluations;
+
+template<>
+InputParameters validParams<NumFusedJacobianEvaluations>();
+
+/**
+ * The number of Jacobian evaluations that took their element contributions from the preceding
+ * residual evaluation (see the Problem parameter "residual_and_jacobian_together").
+ */
+class NumFusedJacobianEvaluations : public GeneralPostprocessor
+{
+public:
+  NumFusedJacobianEvaluations(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+
+  virtual Real getValue() override;
+};
+
+#endif //NUMFUSEDJACOBIANEVALUATIONS_H
@@ -0,0 +1,41 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef NUMMATERIALCACHERESTORES_H
+#define NUMMATERIALCACHERESTORES_H
+
+#include "GeneralPostprocessor.h"
+
+//Forward Declarations
+class NumMaterialCacheRestores;
+
+template<>
+InputParameters validParams<NumMaterialCacheRestores>();
+
+/**
+ * The number of elements whose material property values were restored from the material caches
+ * (see the Problem parameter "cache_materials") on all processors.
+ */
+class NumMaterialCacheRestores : public GeneralPostprocessor
+{
+public:
+  NumMaterialCacheRestores(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+
+  virtual Real getValue() override;
+};
+
+#endif //NUMMATERIALCACHERESTORES_H
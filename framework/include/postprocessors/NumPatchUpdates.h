@@ -0,0 +1,40 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef NUMPATCHUPDATES_H
+#define NUMPATCHUPDATES_H
+
+#include "GeneralPostprocessor.h"
+
+//Forward Declarations
+class NumPatchUpdates;
+
+template<>
+InputParameters validParams<NumPatchUpdates>();
+
+/**
+ * Returns the number of times the geometric search patches have been rebuilt.
+ */
+class NumPatchUpdates : public GeneralPostprocessor
+{
+public:
+  NumPatchUpdates(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+
+  virtual Real getValue() override;
+};
+
+#endif //NUMPATCHUPDATES_H
@@ -36,6 +36,8 @@
 #include <iostream>
 #include <map>
 #include <unordered_map>
+#include <cstring>
+#include <type_traits>
 
 // Forward declarations
 class ColumnMajorMatrix;
@@ -143,6 +145,67 @@ inline void loadHelper(std::istream & stream, std::unordered_map<P,Q> & data, vo
 template<typename P, typename Q>
 inline void loadHelper(std::istream & stream, HashMap<P,Q> & data, void * context);
 
+/**
+ * Whether dataStore() and dataLoad() write and read the raw bytes of a T, so that a contiguous
+ * range of them can be written or read in one go. Specialize this for types whose custom
+ * dataStore()/dataLoad() do the same.
+ */
+template<typename T>
+struct DataIOBulk
+{
+  static const bool value = (std::is_arithmetic<T>::value && !std::is_same<T, bool>::value) || std::is_enum<T>::value;
+};
+
+template<>
+struct DataIOBulk<RealVectorValue>
+{
+  static const bool value = sizeof(RealVectorValue) == LIBMESH_DIM * sizeof(Real);
+};
+
+template<>
+struct DataIOBulk<Point>
+{
+  static const bool value = sizeof(Point) == LIBMESH_DIM * sizeof(Real);
+};
+
+/**
+ * Contiguous range helper routines, these write/read the \p size values starting at \p data
+ * with a single stream operation if DataIOBulk<P> allows it.
+ */
+template<typename P>
+inline void storeContiguous(std::ostream & stream, P * data, unsigned int size, void * context);
+
+template<typename P>
+inline void loadContiguous(std::istream & stream, P * data, unsigned int size, void * context);
+
+/**
+ * Set and map entry helper routines, these gather/scatter the entries through a single buffer
+ * if DataIOBulk allows it.
+ */
+template<typename P>
+inline void storeSetValues(std::ostream & stream, std::set<P> & data, void * context, std::true_type bulk);
+
+template<typename P>
+inline void storeSetValues(std::ostream & stream, std::set<P> & data, void * context, std::false_type bulk);
+
+template<typename P>
+inline void loadSetValues(std::istream & stream, std::set<P> & data, unsigned int size, void * context, std::true_type bulk);
+
+template<typename P>
+inline void loadSetValues(std::istream & stream, std::set<P> & data, unsigned int size, void * context, std::false_type bulk);
+
+template<typename P, typename Q>
+inline void storeMapEntries(std::ostream & stream, std::map<P,Q> & data, void * context, std::true_type bulk);
+
+template<typename P, typename Q>
+inline void storeMapEntries(std::ostream & stream, std::map<P,Q> & data, void * context, std::false_type bulk);
+
+template<typename P, typename Q>
+inline void loadMapEntries(std::istream & stream, std::map<P,Q> & data, unsigned int size, void * context, std::true_type bulk);
+
+template<typename P, typename Q>
+inline void loadMapEntries(std::istream & stream, std::map<P,Q> & data, unsigned int size, void * context, std::false_type bulk);
+
 template<typename T>
 inline void
 dataStore(std::ostream & stream, T & v, void * /*context*/);
@@ -187,8 +250,23 @@ dataStore(std::ostream & stream, std::vector<T> & v, void * context)
   unsigned int size = v.size();
   stream.write((char *) &size, sizeof(size));
 
+  storeContiguous(stream, v.data(), size, context);
+}
+
+// std::vector<bool> packs its values and has no data()
+template<>
+inline void
+dataStore(std::ostream & stream, std::vector<bool> & v, void * context)
+{
+  // First store the size of the vector
+  unsigned int size = v.size();
+  stream.write((char *) &size, sizeof(size));
+
   for (unsigned int i = 0; i < size; i++)
-    storeHelper(stream, v[i], context);
+  {
+    bool x = v[i];
+    storeHelper(stream, x, context);
+  }
 }
 
 template<typename T>
@@ -217,14 +295,7 @@ dataStore(std::ostream & stream, std::set<T> & s, void * context)
   unsigned int size = s.size();
   stream.write((char *) &size, sizeof(size));
 
-  typename std::set<T>::iterator it = s.begin();
-  typename std::set<T>::iterator end = s.end();
-
-  for (; it != end; ++it)
-  {
-    T & x = const_cast<T&>(*it);
-    storeHelper(stream, x, context);
-  }
+  storeSetValues(stream, s, context, std::integral_constant<bool, DataIOBulk<T>::value>());
 }
 
 template<typename T>
@@ -254,17 +325,7 @@ dataStore(std::ostream & stream, std::map<T,U> & m, void * context)
   unsigned int size = m.size();
   stream.write((char *) &size, sizeof(size));
 
-  typename std::map<T,U>::iterator it = m.begin();
-  typename std::map<T,U>::iterator end = m.end();
-
-  for (; it != end; ++it)
-  {
-    T & key = const_cast<T&>(it->first);
-
-    storeHelper(stream, key, context);
-
-    storeHelper(stream, it->second, context);
-  }
+  storeMapEntries(stream, m, context, std::integral_constant<bool, DataIOBulk<T>::value && DataIOBulk<U>::value>());
 }
 
 template<typename T, typename U>
@@ -358,8 +419,26 @@ dataLoad(std::istream & stream, std::vector<T> & v, void * context)
 
   v.resize(size);
 
+  loadContiguous(stream, v.data(), size, context);
+}
+
+// std::vector<bool> packs its values and has no data()
+template<>
+inline void
+dataLoad(std::istream & stream, std::vector<bool> & v, void * context)
+{
+  // First read the size of the vector
+  unsigned int size = 0;
+  stream.read((char *) &size, sizeof(size));
+
+  v.resize(size);
+
   for (unsigned int i = 0; i < size; i++)
-    loadHelper(stream, v[i], context);
+  {
+    bool x;
+    loadHelper(stream, x, context);
+    v[i] = x;
+  }
 }
 
 template<typename T>
@@ -388,12 +467,7 @@ dataLoad(std::istream & stream, std::set<T> & s, void * context)
   unsigned int size = 0;
   stream.read((char *) &size, sizeof(size));
 
-  for (unsigned int i = 0; i < size; i++)
-  {
-    T data;
-    loadHelper(stream, data, context);
-    s.insert(std::move(data));
-  }
+  loadSetValues(stream, s, size, context, std::integral_constant<bool, DataIOBulk<T>::value>());
 }
 
 template<typename T>
@@ -422,14 +496,7 @@ dataLoad(std::istream & stream, std::map<T,U> & m, void * context)
   unsigned int size = 0;
   stream.read((char *) &size, sizeof(size));
 
-  for (unsigned int i = 0; i < size; i++)
-  {
-    T key;
-    loadHelper(stream, key, context);
-
-    U & value = m[key];
-    loadHelper(stream, value, context);
-  }
+  loadMapEntries(stream, m, size, context, std::integral_constant<bool, DataIOBulk<T>::value && DataIOBulk<U>::value>());
 }
 
 template<typename T, typename U>
@@ -615,6 +682,174 @@ loadHelper(std::istream & stream, HashMap<P,Q> & data, void * context)
   dataLoad(stream, data, context);
 }
 
+// Contiguous range Helper Functions
+template<typename P>
+inline void
+storeContiguous(std::ostream & stream, P * data, unsigned int size, void * /*context*/, std::true_type /*bulk*/)
+{
+  if (size)
+    stream.write((const char *) data, size * sizeof(P));
+}
+
+template<typename P>
+inline void
+storeContiguous(std::ostream & stream, P * data, unsigned int size, void * context, std::false_type /*bulk*/)
+{
+  for (unsigned int i = 0; i < size; i++)
+    storeHelper(stream, data[i], context);
+}
+
+template<typename P>
+inline void
+storeContiguous(std::ostream & stream, P * data, unsigned int size, void * context)
+{
+  storeContiguous(stream, data, size, context, std::integral_constant<bool, DataIOBulk<P>::value>());
+}
+
+template<typename P>
+inline void
+loadContiguous(std::istream & stream, P * data, unsigned int size, void * /*context*/, std::true_type /*bulk*/)
+{
+  if (size)
+    stream.read((char *) data, size * sizeof(P));
+}
+
+template<typename P>
+inline void
+loadContiguous(std::istream & stream, P * data, unsigned int size, void * context, std::false_type /*bulk*/)
+{
+  for (unsigned int i = 0; i < size; i++)
+    loadHelper(stream, data[i], context);
+}
+
+template<typename P>
+inline void
+loadContiguous(std::istream & stream, P * data, unsigned int size, void * context)
+{
+  loadContiguous(stream, data, size, context, std::integral_constant<bool, DataIOBulk<P>::value>());
+}
+
+// Set Entry Helper Functions
+template<typename P>
+inline void
+storeSetValues(std::ostream & stream, std::set<P> & data, void * /*context*/, std::true_type /*bulk*/)
+{
+  // Gather the values so they are written in one go
+  std::vector<char> buffer(data.size() * sizeof(P));
+  char * pos = buffer.data();
+  for (const auto & x : data)
+  {
+    std::memcpy(pos, &x, sizeof(P));
+    pos += sizeof(P);
+  }
+  stream.write(buffer.data(), buffer.size());
+}
+
+template<typename P>
+inline void
+storeSetValues(std::ostream & stream, std::set<P> & data, void * context, std::false_type /*bulk*/)
+{
+  for (const auto & x : data)
+    storeHelper(stream, const_cast<P &>(x), context);
+}
+
+template<typename P>
+inline void
+loadSetValues(std::istream & stream, std::set<P> & data, unsigned int size, void * /*context*/, std::true_type /*bulk*/)
+{
+  // Read all the values in one go, they were stored in order
+  std::vector<char> buffer(size * sizeof(P));
+  stream.read(buffer.data(), buffer.size());
+
+  const char * pos = buffer.data();
+  for (unsigned int i = 0; i < size; i++)
+  {
+    P x;
+    std::memcpy(&x, pos, sizeof(P));
+    pos += sizeof(P);
+    data.emplace_hint(data.end(), x);
+  }
+}
+
+template<typename P>
+inline void
+loadSetValues(std::istream & stream, std::set<P> & data, unsigned int size, void * context, std::false_type /*bulk*/)
+{
+  for (unsigned int i = 0; i < size; i++)
+  {
+    P x;
+    loadHelper(stream, x, context);
+    data.insert(std::move(x));
+  }
+}
+
+// Map Entry Helper Functions
+template<typename P, typename Q>
+inline void
+storeMapEntries(std::ostream & stream, std::map<P,Q> & data, void * /*context*/, std::true_type /*bulk*/)
+{
+  // Gather the keys and values so they are written in one go
+  std::vector<char> buffer(data.size() * (sizeof(P) + sizeof(Q)));
+  char * pos = buffer.data();
+  for (const auto & it : data)
+  {
+    std::memcpy(pos, &it.first, sizeof(P));
+    pos += sizeof(P);
+    std::memcpy(pos, &it.second, sizeof(Q));
+    pos += sizeof(Q);
+  }
+  stream.write(buffer.data(), buffer.size());
+}
+
+template<typename P, typename Q>
+inline void
+storeMapEntries(std::ostream & stream, std::map<P,Q> & data, void * context, std::false_type /*bulk*/)
+{
+  for (auto & it : data)
+  {
+    P & key = const_cast<P &>(it.first);
+
+    storeHelper(stream, key, context);
+
+    storeHelper(stream, it.second, context);
+  }
+}
+
+template<typename P, typename Q>
+inline void
+loadMapEntries(std::istream & stream, std::map<P,Q> & data, unsigned int size, void * /*context*/, std::true_type /*bulk*/)
+{
+  // Read all the entries in one go, they were stored in key order
+  std::vector<char> buffer(size * (sizeof(P) + sizeof(Q)));
+  stream.read(buffer.data(), buffer.size());
+
+  const char * pos = buffer.data();
+  for (unsigned int i = 0; i < size; i++)
+  {
+    P key;
+    Q value;
+    std::memcpy(&key, pos, sizeof(P));
+    pos += sizeof(P);
+    std::memcpy(&value, pos, sizeof(Q));
+    pos += sizeof(Q);
+    data.emplace_hint(data.end(), key, value);
+  }
+}
+
+template<typename P, typename Q>
+inline void
+loadMapEntries(std::istream & stream, std::map<P,Q> & data, unsigned int size, void * context, std::false_type /*bulk*/)
+{
+  for (unsigned int i = 0; i < size; i++)
+  {
+    P key;
+    loadHelper(stream, key, context);
+
+    Q & value = data[key];
+    loadHelper(stream, value, context);
+  }
+}
+
 // Specializations for Backup type
 template<>
 inline void
@@ -23,6 +23,9 @@
 #include <sstream>
 #include <string>
 #include <list>
+#include <set>
+#include <map>
+#include <cstdint>
 
 // Forward declarations
 class RestartableDatas;
@@ -46,8 +49,42 @@ public:
    */
   void writeRestartableData(std::string base_file_name, const RestartableDatas & restartable_datas, std::set<std::string> & _recoverable_data);
 
+  /**
+   * Serializes the restartable data of each thread into a memory buffer, which can be written
+   * with writeRestartableDataBuffers() while the data itself keeps changing.
+   */
+  std::vector<std::string> serializeRestartableDataBuffers(const std::string & base_file_name, const RestartableDatas & restartable_datas);
+
+  /**
+   * Writes the buffers created by serializeRestartableDataBuffers() to the restart files of
+   * processor \p proc_id. Each file is written under a temporary name and renamed once it is
+   * complete. This only touches the file system, so it may be called from a separate I/O thread.
+   * Throws a std::runtime_error if a file could not be written.
+   */
+  static void writeRestartableDataBuffers(const std::string & base_file_name, processor_id_type proc_id, const std::vector<std::string> & buffers);
+
+  /**
+   * Write out the restartable data of all processors and threads into the single file \p file_name
+   * using MPI-IO (plain file IO without MPI). The file starts with an index of the offset and size
+   * of each processor's and thread's data. This must be called on all processors.
+   */
+  void writeSharedRestartableData(const std::string & file_name, const RestartableDatas & restartable_datas);
+
+  /**
+   * Makes writeRestartableData() and serializeRestartableDataBuffers() only write the data that
+   * changed since the previous write. The other data refers to the earlier file holding it.
+   */
+  void setIncremental(bool incremental) { _incremental = incremental; }
+
+  /**
+   * The base file names of the earlier writes the last incremental write refers to
+   */
+  const std::set<std::string> & referencedFiles() const { return _referenced_files; }
+
   /**
    * Read restartable data header to verify that we are restarting on the correct number of processors and threads.
+   * If \p base_file_name itself is a file, it is read as the single file written by
+   * writeSharedRestartableData().
    */
   void readRestartableDataHeader(std::string base_file_name);
 
@@ -72,10 +109,16 @@ private:
    */
   void serializeRestartableData(const std::map<std::string, RestartableDataValue *> & restartable_data, std::ostream & stream);
 
+  /**
+   * Serializes the data of thread \p tid that goes to the restart file with base \p base_file_name,
+   * which is used to refer to unchanged data in incremental writes.
+   */
+  void serializeRestartableData(const std::map<std::string, RestartableDataValue *> & restartable_data, std::ostream & stream, const std::string & base_file_name, THREAD_ID tid);
+
   /**
    * Deserializes the data from the stream object.
    */
-  void deserializeRestartableData(const std::map<std::string, RestartableDataValue *> & restartable_data, std::istream & stream, const std::set<std::string> & recoverable_data);
+  void deserializeRestartableData(const std::map<std::string, RestartableDataValue *> & restartable_data, std::istream & stream, const std::set<std::string> & recoverable_data, unsigned int file_version = 2, const std::string & file_name = "");
 
   /**
    * Serializes the data for the Systems in FEProblemBase
@@ -87,11 +130,51 @@ private:
    */
   void deserializeSystems(std::istream & stream);
 
+  /**
+   * Reads and checks the header written by serializeRestartableData(), returns the file version
+   */
+  unsigned int checkRestartableDataHeader(std::istream & stream, bool check_n_threads);
+
+  /**
+   * The name of the restart file of processor \p proc_id and thread \p tid
+   */
+  static std::string restartFileName(const std::string & base_file_name, processor_id_type proc_id, THREAD_ID tid, unsigned int n_threads);
+
+  /**
+   * Sets up the input streams of the threads from the file written by writeSharedRestartableData()
+   */
+  void readSharedRestartableDataHeader(const std::string & file_name);
+
   /// Reference to a FEProblemBase being restarted
   FEProblemBase & _fe_problem;
 
-  /// A vector of file handles, one per thread
-  std::vector<std::shared_ptr<std::ifstream>> _in_file_handles;
+  /// The SHA-256 digest and size of the last written value of a restartable data and where it is stored
+  struct StoredData
+  {
+    std::string _digest;
+    std::size_t _size;
+    std::string _base_file_name;
+    std::string _file_name;
+    uint64_t _offset;
+  };
+
+  /// Whether only changed data is written
+  bool _incremental;
+
+  /// The last written values of the restartable data, per thread
+  std::vector<std::map<std::string, StoredData>> _stored_data;
+
+  /// The base file names of the earlier writes the last incremental write refers to
+  std::set<std::string> _referenced_files;
+
+  /// A vector of input streams, one per thread
+  std::vector<std::shared_ptr<std::istream>> _in_streams;
+
+  /// The names of the files (or shared file) being read, per thread
+  std::vector<std::string> _in_file_names;
+
+  /// The versions of the files being read, per thread
+  std::vector<unsigned int> _in_file_versions;
 };
 
 #endif /* RESTARTABLEDATAIO_H */
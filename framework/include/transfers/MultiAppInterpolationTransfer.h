@@ -17,6 +17,11 @@
 
 // MOOSE includes
 #include "MultiAppTransfer.h"
+#include "KDTree.h"
+#include "TransferPlan.h"
+
+// libMesh includes
+#include "libmesh/meshfree_interpolation.h"
 
 // Forward declarations
 class MultiAppInterpolationTransfer;
@@ -48,6 +53,19 @@ protected:
    */
   Node * getNearestNode(const Point & p, Real & distance, const MeshBase::const_node_iterator & nodes_begin, const MeshBase::const_node_iterator & nodes_end);
 
+  /**
+   * Interpolate the source data held by \p idi to the point \p pt.  With fixed
+   * meshes and inverse distance interpolation the neighbors and weights of
+   * each target point are recorded in \p plan on the first execution and
+   * reused after that.
+   * @param row The index of \p pt among the target points of \p plan
+   */
+  Number interpolate(InverseDistanceInterpolation<LIBMESH_DIM> & idi,
+                     const std::vector<std::string> & vars,
+                     const Point & pt,
+                     TransferPlan & plan,
+                     std::size_t row);
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
 
@@ -55,6 +73,15 @@ protected:
   Real _power;
   MooseEnum _interp_type;
   Real _radius;
+
+  /// If true the interpolation weights are cached
+  bool _fixed_meshes;
+
+  /// The recorded interpolation weights for each target app
+  std::map<unsigned int, TransferPlan> _plans;
+
+  /// Index of the source points used while recording the plans
+  std::unique_ptr<KDTree> _src_tree;
 };
 
 #endif /* MULTIAPPINTERPOLATIONTRANSFER_H */
@@ -16,6 +16,13 @@
 #define MULTIAPPMESHFUNCTIONTRANSFER_H
 
 #include "MultiAppTransfer.h"
+#include "TransferPlan.h"
+
+// libMesh forward declarations
+namespace libMesh
+{
+class MeshFunction;
+}
 
 // Forward declarations
 class MultiAppMeshFunctionTransfer;
@@ -39,9 +46,68 @@ public:
   virtual void execute() override;
 
 protected:
+  /**
+   * Find the processors whose "from" domains might contain each of the local
+   * target nodes/centroids and fill _outgoing_points and _point_requests.
+   */
+  void buildOutgoingPoints();
+
+  /**
+   * Send _outgoing_points to the processors that need them and fill
+   * _incoming_points.  Only processors that share points communicate.
+   */
+  void exchangePoints();
+
+  /**
+   * Record how the point \p pt is evaluated in local "from" domain \p i_from
+   * (invalid_uint if none) as the next row of \p plan.
+   */
+  void addPlanRow(TransferPlan & plan,
+                  unsigned int i_from,
+                  const Point & pt,
+                  const std::vector<std::shared_ptr<MeshFunction>> & local_meshfuns);
+
+  /**
+   * Pick the value for the target point (i_to, id) out of the evaluations
+   * returned by the other processors.
+   * @return true if one of the processors found the point in its meshes
+   */
+  bool findBestValue(unsigned int i_to,
+                     dof_id_type id,
+                     const std::vector<std::vector<Real> > & incoming_evals,
+                     const std::vector<std::vector<unsigned int> > & incoming_app_ids,
+                     Real & best_val);
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
   bool _error_on_miss;
+
+  /// If true the point routing and the evaluations are only computed once
+  bool _fixed_meshes;
+
+  /// Whether the point routing from a previous execution can be reused
+  bool _plan_cached;
+
+  /// The MultiApp's number of redistributions when the routing was cached
+  unsigned int _plan_redistributions;
+
+  /// Bounding boxes of this processor's "from" domains
+  std::vector<MeshTools::BoundingBox> _local_bboxes;
+
+  /// The points sent to each processor for evaluation
+  std::vector<std::vector<Point> > _outgoing_points;
+
+  /// (processor, index into _outgoing_points) of the evaluations requested for each (i_to, node/elem id)
+  std::map<std::pair<unsigned int, dof_id_type>, std::vector<std::pair<processor_id_type, unsigned int> > > _point_requests;
+
+  /// The points each processor sent us to evaluate
+  std::vector<std::vector<Point> > _incoming_points;
+
+  /// The local "from" domain containing each of the _incoming_points (invalid_uint if none)
+  std::vector<std::vector<unsigned int> > _incoming_apps;
+
+  /// The recorded evaluation of the _incoming_points (with fixed meshes)
+  std::vector<TransferPlan> _plans;
 };
 
 #endif /* MULTIAPPMESHFUNCTIONTRANSFER_H */
@@ -17,6 +17,7 @@
 
 // MOOSE includes
 #include "MultiAppTransfer.h"
+#include "KDTree.h"
 
 // Forward declarations
 class MultiAppNearestNodeTransfer;
@@ -70,6 +71,14 @@ protected:
 
   void getLocalNodes(MooseMesh * mesh, std::vector<Node *> & local_nodes);
 
+  /**
+   * Build the spatial index over the searchable nodes of each local "from"
+   * domain.  An existing index is refit to the current node positions when the
+   * set of nodes has not changed, and rebuilt otherwise.
+   * @param n_local_froms The number of "from" domains owned by this processor
+   */
+  void updateFromTrees(unsigned int n_local_froms);
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
 
@@ -88,6 +97,15 @@ protected:
   std::vector< std::vector<dof_id_type> > & _cached_dof_ids;
   std::map<dof_id_type, unsigned int> & _cached_from_inds;
   std::map<dof_id_type, unsigned int> & _cached_qp_inds;
+
+  /// The MultiApp's number of redistributions when the nearest nodes were cached
+  unsigned int _cached_redistributions;
+
+  /// Nearest node search trees for each local "from" domain
+  std::vector<std::unique_ptr<KDTree> > _from_trees;
+
+  /// The nodes held by each of the _from_trees, in the order they were inserted
+  std::vector<std::vector<Node *> > _from_tree_nodes;
 };
 
 #endif /* MULTIAPPNEARESTNODETRANSFER_H */
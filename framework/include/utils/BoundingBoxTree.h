@@ -0,0 +1,67 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BOUNDINGBOXTREE_H
+#define BOUNDINGBOXTREE_H
+
+// MOOSE includes
+#include "BoxTree.h"
+
+/**
+ * A bounding volume hierarchy over axis-aligned boxes, used to find the
+ * boxes that contain a point without testing every one of them.
+ *
+ * The tree is split on the box centers. When the boxes move but keep their
+ * identity (e.g. faces on a displaced mesh) refit() updates the node boxes
+ * without rebuilding the hierarchy.
+ */
+class BoundingBoxTree : public BoxTree
+{
+public:
+  /**
+   * Builds the tree.
+   * @param lower The lower corner of each box
+   * @param upper The upper corner of each box
+   * @param max_leaf_size The maximum number of boxes held by a leaf
+   */
+  BoundingBoxTree(const std::vector<Point> & lower,
+                  const std::vector<Point> & upper,
+                  unsigned int max_leaf_size = 4);
+
+  /**
+   * Finds all of the boxes containing \p point (boundaries included).
+   * The indices (into the vectors passed to the constructor) are returned in increasing order.
+   */
+  void findBoxes(const Point & point, std::vector<std::size_t> & indices) const;
+
+  /**
+   * Replaces the boxes while keeping the tree structure. The number of
+   * boxes must not change.
+   */
+  void refit(const std::vector<Point> & lower, const std::vector<Point> & upper);
+
+protected:
+  virtual const Point & itemLower(std::size_t i) const override { return _lower[i]; }
+  virtual const Point & itemUpper(std::size_t i) const override { return _upper[i]; }
+  virtual void permuteItems(std::size_t begin, const std::vector<std::size_t> & order) override;
+
+  /// Whether \p point is inside the box [lower, upper]
+  static bool contains(const Point & lower, const Point & upper, const Point & point);
+
+  /// The box corners, reordered so that each node holds a contiguous range
+  std::vector<Point> _lower;
+  std::vector<Point> _upper;
+};
+
+#endif // BOUNDINGBOXTREE_H
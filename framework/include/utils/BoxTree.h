@@ -0,0 +1,100 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BOXTREE_H
+#define BOXTREE_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+// libMesh includes
+#include "libmesh/point.h"
+
+// C++ includes
+#include <vector>
+
+/**
+ * The hierarchy shared by KDTree and BoundingBoxTree: a binary tree over items
+ * with an axis-aligned box each (a point is a box with equal corners).
+ *
+ * Every node holds a contiguous range of the items and the union of their boxes.
+ * Nodes are split along their widest dimension at the median item center. The
+ * derived classes store the items and reorder them when asked to.
+ */
+class BoxTree
+{
+public:
+  virtual ~BoxTree() = default;
+
+  /// The number of items in the tree
+  std::size_t size() const { return _index.size(); }
+
+protected:
+  /**
+   * @param n_items The number of items
+   * @param max_leaf_size The maximum number of items held by a leaf
+   */
+  BoxTree(std::size_t n_items, unsigned int max_leaf_size);
+
+  /// Node of the tree holding the range [_begin, _end) of the items
+  struct Node
+  {
+    std::size_t _begin;
+    std::size_t _end;
+
+    /// Children (invalid_id for leaves)
+    std::size_t _left;
+    std::size_t _right;
+
+    /// The union of the boxes of the items in this node
+    Point _lower;
+    Point _upper;
+  };
+
+  /// The corners of the box of the item at position \p i
+  virtual const Point & itemLower(std::size_t i) const = 0;
+  virtual const Point & itemUpper(std::size_t i) const = 0;
+
+  /**
+   * Reorders the items stored by the derived class: the item at position
+   * begin + k takes the value of the item at position order[k].
+   */
+  virtual void permuteItems(std::size_t begin, const std::vector<std::size_t> & order) = 0;
+
+  /// Builds the tree over the items, to be called once the derived class stores them
+  void buildTree();
+
+  /// Recomputes the boxes of all nodes after the items moved
+  void refitTree();
+
+  /// Index of the item at each position in the original order
+  std::vector<std::size_t> _index;
+
+  /// The tree; the root is _nodes[0]
+  std::vector<Node> _nodes;
+
+  /// Maximum number of items in a leaf
+  const unsigned int _max_leaf_size;
+
+  static const std::size_t invalid_id;
+
+private:
+  /// Recursively builds the node holding [begin, end) and returns its id
+  std::size_t build(std::size_t begin, std::size_t end);
+
+  /// Recomputes the box of node \p id from its items or children
+  void updateBox(std::size_t id);
+};
+
+#endif // BOXTREE_H
@@ -107,6 +107,12 @@ public:
    */
   void setPrecision(unsigned int precision){ _csv_precision = precision; }
 
+  /**
+   * By default printCSV rewrites the whole file, when streaming only the new rows are appended
+   * and the rows already written are dropped from the table (the last one is kept so it can be
+   * updated). The file is only rewritten when columns are added.
+   */
+  void setStreaming(bool streaming){ _csv_streaming = streaming; }
 
 protected:
   void printTablePiece(std::ostream & out, unsigned int last_n_entries, std::map<std::string, unsigned short> & col_widths,
@@ -151,6 +157,16 @@ private:
   /// idempotent.
   void open(const std::string & file_name);
 
+  /// Write the csv header or a single csv row
+  void printCSVHeader(std::ostream & out, bool align, std::map<std::string, unsigned int> & width);
+  void printCSVRow(std::ostream & out, Real time, std::map<std::string, Real> & row, bool align, std::map<std::string, unsigned int> & width);
+
+  /// printCSV when streaming: append the rows that were not written yet
+  void streamCSV(const std::string & file_name, int interval, bool align);
+
+  /// Start a streamed csv file, keeping the rows already in the file when continuing it
+  void rewriteCSV(const std::string & file_name, bool align, std::map<std::string, unsigned int> & width);
+
   /// The optional output file stream
   std::string _output_file_name;
   std::ofstream _output_file;
@@ -168,6 +184,25 @@ private:
   /// *.csv file precision, defaults to 14
   unsigned int _csv_precision;
 
+  /// Whether only new rows are appended to the *.csv file
+  bool _csv_streaming;
+
+  /// Set when the table was loaded from a restart file, the streamed file is then rewritten
+  bool _csv_loaded;
+
+  /// The columns written to the streamed *.csv file
+  std::set<std::string> _csv_column_names;
+
+  /// The last row written to the streamed *.csv file and where it starts
+  bool _csv_has_written_row;
+  Real _csv_last_written_key;
+  std::string _csv_last_row;
+  std::streampos _csv_last_row_pos;
+
+  /// The last row considered for streaming and the number of rows considered (for the interval)
+  Real _csv_last_seen_key;
+  int _csv_row_counter;
+
   friend void dataStore<FormattedTable>(std::ostream & stream, FormattedTable & table, void * context);
   friend void dataLoad<FormattedTable>(std::istream & stream, FormattedTable & v, void * context);
 };
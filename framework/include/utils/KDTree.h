@@ -0,0 +1,86 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef KDTREE_H
+#define KDTREE_H
+
+// MOOSE includes
+#include "BoxTree.h"
+
+/**
+ * A k-d tree over a fixed set of points used for nearest neighbor queries.
+ *
+ * Every node of the tree stores the bounding box of the points below it, and the
+ * search prunes on the distance to those boxes. This keeps queries exact after
+ * refit() has moved the points without rebuilding the tree structure, which is
+ * what is needed on displaced meshes where the topology does not change.
+ */
+class KDTree : public BoxTree
+{
+public:
+  /**
+   * Builds the tree.
+   * @param points The points to search. They are copied into the tree.
+   * @param max_leaf_size The maximum number of points held by a leaf
+   */
+  KDTree(const std::vector<Point> & points, unsigned int max_leaf_size = 10);
+
+  /**
+   * Finds the \p n_neighbors points closest to \p query.
+   * The indices (into the vector passed to the constructor) are returned in order
+   * of increasing distance. Points at equal distance are ordered by index, so
+   * the result does not depend on the tree layout.
+   */
+  void neighborSearch(const Point & query,
+                      unsigned int n_neighbors,
+                      std::vector<std::size_t> & return_index) const;
+
+  /**
+   * Same as above, also returning the squared distance to each of the neighbors.
+   */
+  void neighborSearch(const Point & query,
+                      unsigned int n_neighbors,
+                      std::vector<std::size_t> & return_index,
+                      std::vector<Real> & return_dist_sqr) const;
+
+  /**
+   * Moves the points to new locations while keeping the tree structure.
+   * Queries remain exact; their cost grows if the points move far relative
+   * to one another, in which case the tree should be rebuilt instead.
+   * @param points The new point locations, in the order passed to the constructor
+   */
+  void refit(const std::vector<Point> & points);
+
+protected:
+  /// A (squared distance, index) candidate
+  typedef std::pair<Real, std::size_t> Candidate;
+
+  virtual const Point & itemLower(std::size_t i) const override { return _points[i]; }
+  virtual const Point & itemUpper(std::size_t i) const override { return _points[i]; }
+  virtual void permuteItems(std::size_t begin, const std::vector<std::size_t> & order) override;
+
+  /// Squared distance from \p query to the bounding box of \p node
+  Real boxDistanceSqr(const Node & node, const Point & query) const;
+
+  /// Recursive search, maintaining a max-heap of the best \p n_neighbors candidates
+  void search(std::size_t id,
+              const Point & query,
+              unsigned int n_neighbors,
+              std::vector<Candidate> & heap) const;
+
+  /// The points, reordered so that each node holds a contiguous range
+  std::vector<Point> _points;
+};
+
+#endif // KDTREE_H
@@ -16,6 +16,7 @@
 #define ARRAY_H
 
 #include <vector>
+#include <algorithm>
 #include "MooseError.h"
 
 
@@ -29,7 +30,8 @@ public:
   MooseArray() :
     _data(NULL),
     _size(0),
-    _allocated_size(0)
+    _allocated_size(0),
+    _external(false)
   {}
 
   /**
@@ -38,7 +40,8 @@ public:
   explicit
   MooseArray(const unsigned int size) :
     _data(NULL),
-    _allocated_size(0)
+    _allocated_size(0),
+    _external(false)
   {
     resize(size);
   }
@@ -50,7 +53,8 @@ public:
   explicit
   MooseArray(const unsigned int size, const T & default_value) :
     _data(NULL),
-    _allocated_size(0)
+    _allocated_size(0),
+    _external(false)
   {
     resize(size);
 
@@ -70,12 +74,27 @@ public:
   {
     if (_data != NULL)
     {
-      delete [] _data;
+      if (!_external)
+        delete [] _data;
       _data = NULL;
       _allocated_size = _size = 0;
     }
+    _external = false;
   }
 
+  /**
+   * Makes this array operate on \p allocated_size entries of memory it does not own (e.g. a
+   * slice of a larger block).  The current data is freed, but the current size is kept (up to
+   * \p allocated_size).  The memory is never freed by this array; growing past
+   * \p allocated_size switches back to memory owned by the array.
+   */
+  void attach(T * data, const unsigned int allocated_size);
+
+  /**
+   * Whether or not the data is owned by someone else (see attach())
+   */
+  bool isExternal() const { return _external; }
+
   /**
    * Change the number of elements the array can store to zero.
    *
@@ -197,6 +216,9 @@ private:
 
   /// Number of allocated memory positions for storage.
   unsigned int _allocated_size;
+
+  /// Whether _data belongs to someone else (see attach())
+  bool _external;
 };
 
 template<typename T>
@@ -208,6 +230,20 @@ MooseArray<T>::setAllValues(const T & value)
     _data[i] = value;
 }
 
+template<typename T>
+inline
+void
+MooseArray<T>::attach(T * data, const unsigned int allocated_size)
+{
+  unsigned int size = std::min(_size, allocated_size);
+  release();
+
+  _data = data;
+  _allocated_size = allocated_size;
+  _size = size;
+  _external = true;
+}
+
 template<typename T>
 inline
 void
@@ -228,11 +264,12 @@ MooseArray<T>::resize(const unsigned int size)
     T * new_pointer = new T[size];
     mooseAssert(new_pointer, "Failed to allocate MooseArray memory!");
 
-    if (_data != NULL)
+    if (_data != NULL && !_external)
       delete [] _data;
     _data = new_pointer;
     _allocated_size = size;
     _size = size;
+    _external = false;
   }
 }
 
@@ -250,11 +287,13 @@ MooseArray<T>::resize(const unsigned int size, const T & default_value)
     {
       for (unsigned int i=0; i<_size; i++)
         new_pointer[i] = _data[i];
-      delete [] _data;
+      if (!_external)
+        delete [] _data;
     }
 
     _data = new_pointer;
     _allocated_size = size;
+    _external = false;
   }
 
   for (unsigned int i=_size; i<size; i++)
@@ -299,6 +338,7 @@ MooseArray<T>::swap(MooseArray & rhs)
   std::swap(_data, rhs._data);
   std::swap(_size, rhs._size);
   std::swap(_allocated_size, rhs._allocated_size);
+  std::swap(_external, rhs._external);
 }
 
 template<typename T>
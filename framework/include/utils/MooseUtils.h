@@ -26,6 +26,7 @@
 #include <vector>
 #include <map>
 #include <list>
+#include <mutex>
 
 // Forward Declarations
 namespace libMesh
@@ -88,6 +89,13 @@ namespace MooseUtils
    */
   void serialEnd(const libMesh::Parallel::Communicator & comm);
 
+  /**
+   * The lock that serializes the access to ExodusII files within this process. The ExodusII
+   * library is not thread safe, and Exodus outputs may write on a separate thread, so every read
+   * or write of an ExodusII (or Nemesis) file must hold it.
+   */
+  std::recursive_mutex & exodusMutex();
+
   /**
    * Function tests if the supplied filename as the desired extension
    * @param filename The filename to test the extension
@@ -282,11 +290,17 @@ namespace MooseUtils
 
   /**
    * Returns the most recent checkpoint file given a list of files.
+   * Checkpoints without the marker written once all of their files are complete are skipped.
    * If a suitable file isn't found the empty string is returned
    * @param checkpoint_files the list of files to analyze
    */
   std::string getRecoveryFileBase(const std::list<std::string> & checkpoint_files);
 
+  /**
+   * Returns the SHA-256 digest (FIPS 180-4) of \p data as 32 raw bytes
+   */
+  std::string sha256(const std::string & data);
+
   /*
    * Checks to see if a string matches a search string
    * @param name The name to check
@@ -0,0 +1,146 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef OBJECTTIMING_H
+#define OBJECTTIMING_H
+
+// MOOSE includes
+#include "Moose.h"
+
+// C++ includes
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Forward declarations
+class MooseObject;
+
+/**
+ * Accumulates the number of calls and the time spent in individual objects (kernels, nodal
+ * kernels, scalar kernels, DG, interface and Dirac kernels, integrated and nodal boundary
+ * conditions, materials, user objects, aux kernels).
+ *
+ * The timing is off by default. Once enabled, the computing loops time every object with an
+ * ObjectTimer, which costs two clock reads and a hash lookup per call and nothing at all while the
+ * timing is off. Every thread accumulates into its own records, keyed by the address of the object,
+ * which are summed by object name over the threads and the processors for the report.
+ */
+class ObjectTiming
+{
+public:
+  typedef std::chrono::steady_clock Clock;
+
+  /// The timing of an object, summed over the threads and the processors
+  struct Summary
+  {
+    std::string category;
+    std::string type;
+    std::string name;
+    unsigned long int calls;
+    /// Total time over all processors and the largest time of a single processor (seconds)
+    Real time;
+    Real max_time;
+  };
+
+  ObjectTiming();
+
+  /**
+   * Turn the timing on
+   */
+  void enable() { _enabled = true; }
+  bool enabled() const { return _enabled; }
+
+  /**
+   * Add a call to an object on the current thread
+   * @param category The kind of the object, used as a label in the report
+   */
+  void add(const MooseObject & object, const char * category, Clock::duration time);
+
+  /**
+   * Sum the timings over the threads and the processors, sorted by decreasing time.
+   * This is collective, the result is only complete on processor 0.
+   */
+  std::vector<Summary> summarize(const Parallel::Communicator & comm) const;
+
+  /**
+   * Print the summaries as a table or as CSV
+   */
+  static void printTable(std::ostream & out, const std::vector<Summary> & summaries);
+  static void printCSV(std::ostream & out, const std::vector<Summary> & summaries);
+
+private:
+  struct Record
+  {
+    const char * category;
+    std::string type;
+    std::string name;
+    unsigned long int calls;
+    Clock::duration time;
+  };
+
+  /// The records of a thread and the index of the record of each object
+  struct ThreadData
+  {
+    std::unordered_map<const MooseObject *, std::size_t> index;
+    std::vector<Record> records;
+  };
+
+  /// The data of the current thread, created the first time the thread times an object
+  ThreadData & threadData();
+
+  /// Unique id of this instance, used to validate the cached thread data
+  const unsigned int _id;
+
+  bool _enabled;
+
+  /// The data of every thread that timed an object
+  std::vector<std::unique_ptr<ThreadData> > _threads;
+  std::map<std::thread::id, ThreadData *> _thread_ids;
+
+  /// Protects the threads
+  mutable std::mutex _mutex;
+};
+
+/**
+ * Times an object for the lifetime of the timer, when the object timing is on.
+ */
+class ObjectTimer
+{
+public:
+  ObjectTimer(const MooseObject & object, const char * category) :
+      _object(Moose::object_timing.enabled() ? &object : nullptr),
+      _category(category)
+  {
+    if (_object)
+      _start = ObjectTiming::Clock::now();
+  }
+
+  ~ObjectTimer()
+  {
+    if (_object)
+      Moose::object_timing.add(*_object, _category, ObjectTiming::Clock::now() - _start);
+  }
+
+private:
+  const MooseObject * _object;
+  const char * _category;
+  ObjectTiming::Clock::time_point _start;
+};
+
+#endif // OBJECTTIMING_H
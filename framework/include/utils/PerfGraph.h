@@ -0,0 +1,184 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef PERFGRAPH_H
+#define PERFGRAPH_H
+
+// MOOSE includes
+#include "Moose.h"
+
+// C++ includes
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Hierarchical timing of registered code sections.
+ *
+ * A section is registered once with its name and category, which returns the integer id used to
+ * time it with push() and pop(). Every thread builds its own call tree: a node holds the number of
+ * calls and the time spent in a section along one call path, and the time spent in its children,
+ * so both the self and the total time of each section are available.
+ *
+ * The results can be printed as a table or as JSON at any time, and the individual timed events
+ * can be recorded and printed in the Chrome trace event format (chrome://tracing). They should
+ * be read from the main thread while no threaded loop is running.
+ */
+class PerfGraph
+{
+public:
+  /// The accumulated data of a section, over all of its call paths and threads (times in seconds)
+  struct SectionData
+  {
+    unsigned long int calls = 0;
+    Real self = 0;
+    Real children = 0;
+    Real total = 0;
+  };
+
+  PerfGraph(const std::string & name);
+
+  /**
+   * Returns the id of a section, registering it the first time
+   */
+  unsigned int registerSection(const std::string & section_name, const std::string & category);
+
+  /**
+   * Starts and stops timing a section on the current thread, the sections must be nested.
+   * A section opened while the timing is off is not timed even if the timing is turned on before
+   * it is closed, and a section closed while the timing is off is not timed either.
+   */
+  void push(unsigned int section_id);
+  void pop(unsigned int section_id);
+
+  /**
+   * Turn the timing on or off, push() and pop() only keep the sections nested while it is off
+   */
+  void enable() { _enabled = true; }
+  void disable() { _enabled = false; }
+  bool enabled() const { return _enabled; }
+
+  /**
+   * Record every timed event, needed for printTrace()
+   */
+  void enableTrace(bool trace) { _trace = trace; }
+
+  /**
+   * The time since the creation of the graph
+   */
+  Real elapsedTime() const;
+
+  /**
+   * The time spent in the outermost sections of the main thread, including the running one
+   */
+  Real activeTime() const;
+
+  /**
+   * The accumulated data of a section, empty if the section does not exist
+   */
+  SectionData sectionData(const std::string & section_name, const std::string & category) const;
+
+  /**
+   * Print the call trees as an indented table
+   */
+  void printTable(std::ostream & out) const;
+
+  /**
+   * Print the call trees as JSON
+   */
+  void printJSON(std::ostream & out) const;
+
+  /**
+   * Print the recorded events in the Chrome trace event format
+   * @param pid The process id of the events, e.g. the processor id
+   */
+  void printTrace(std::ostream & out, processor_id_type pid = 0) const;
+
+private:
+  typedef std::chrono::steady_clock Clock;
+
+  /// A section along a call path
+  struct Node
+  {
+    unsigned int section;
+    std::size_t parent;
+    unsigned long int calls;
+    Clock::duration total;
+    Clock::duration children;
+    std::vector<std::pair<unsigned int, std::size_t> > child_nodes;
+  };
+
+  /// A single timed event, only recorded for traces
+  struct Event
+  {
+    unsigned int section;
+    Clock::time_point start;
+    Clock::duration duration;
+  };
+
+  /// An open section, node 0 for the sections opened while the timing is off
+  struct Frame
+  {
+    std::size_t node;
+    unsigned int section;
+    Clock::time_point start;
+  };
+
+  /// The call tree of a thread, node 0 is the root
+  struct ThreadData
+  {
+    unsigned int index;
+    std::vector<Node> nodes;
+    std::vector<Frame> stack;
+    std::vector<Event> events;
+  };
+
+  /// The data of the current thread, created the first time the thread times a section
+  ThreadData & threadData();
+
+  /// Helpers for the printing methods
+  std::string sectionLabel(unsigned int section_id) const;
+  void printTableNode(std::ostream & out, const ThreadData & data, std::size_t node_id, unsigned int depth, std::size_t label_width, Real total) const;
+  void printJSONNode(std::ostream & out, const ThreadData & data, std::size_t node_id, unsigned int depth) const;
+  std::size_t labelWidth(const ThreadData & data, std::size_t node_id, unsigned int depth) const;
+
+  /// The name of the graph
+  const std::string _name;
+
+  /// Unique id of this graph, used to validate the cached thread data
+  const unsigned int _graph_id;
+
+  /// The creation time
+  const Clock::time_point _start;
+
+  bool _enabled;
+  bool _trace;
+
+  /// The names and categories of the sections and their ids
+  std::vector<std::pair<std::string, std::string> > _sections;
+  std::map<std::pair<std::string, std::string>, unsigned int> _section_ids;
+
+  /// The data of every thread that timed a section
+  std::vector<std::unique_ptr<ThreadData> > _threads;
+  std::map<std::thread::id, ThreadData *> _thread_ids;
+
+  /// Protects the sections and the threads
+  mutable std::mutex _mutex;
+};
+
+#endif // PERFGRAPH_H
@@ -0,0 +1,103 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef PICARDACCELERATION_H
+#define PICARDACCELERATION_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+// libMesh includes
+#include "libmesh/numeric_vector.h"
+
+// C++ includes
+#include <deque>
+#include <memory>
+
+/**
+ * Relaxation and acceleration of a fixed point (Picard) iteration x = G(x).
+ *
+ * Given the iterate x_k that went into an iteration and the result G(x_k)
+ * that came out of it, computes the next iterate x_{k+1} with one of:
+ *
+ *  - constant relaxation: x_{k+1} = x_k + w (G(x_k) - x_k)
+ *  - Aitken dynamic relaxation: as above, with w recomputed every iteration
+ *    from the last two residuals (Irons and Tuck)
+ *  - Anderson mixing: x_{k+1} is the (damped) combination of the last
+ *    iterates that minimizes the linearized residual (Walker and Ni)
+ */
+class PicardAcceleration
+{
+public:
+  /**
+   * @param type One of "none", "constant", "aitken" or "anderson"
+   * @param relaxation_factor The constant relaxation factor, the initial factor for Aitken and the damping for Anderson
+   * @param history The number of previous iterations used by Anderson mixing
+   */
+  PicardAcceleration(const std::string & type, Real relaxation_factor, unsigned int history);
+
+  /// Forgets all previous iterations (call this at the beginning of each time step)
+  void reset();
+
+  /**
+   * Replaces \p solution = G(x_k) by the next iterate x_{k+1}.
+   * @param solution G(x_k) on input, x_{k+1} on output
+   * @param iterate The iterate x_k that produced \p solution
+   * @return The norm of the residual G(x_k) - x_k
+   */
+  Real update(NumericVector<Number> & solution, const NumericVector<Number> & iterate);
+
+  /// Whether this does anything besides plain Picard iterations
+  bool isOn() const { return _type != NONE; }
+
+  /// The relaxation factor used in the last update()
+  Real relaxationFactor() const { return _omega; }
+
+protected:
+  enum AccelerationType
+  {
+    NONE,
+    CONSTANT,
+    AITKEN,
+    ANDERSON
+  };
+
+  /// Anderson mixing step, fills in \p solution from \p iterate and the residual \p residual
+  void andersonUpdate(NumericVector<Number> & solution, const NumericVector<Number> & iterate, const NumericVector<Number> & residual);
+
+  AccelerationType _type;
+
+  /// The relaxation factor given by the user
+  const Real _relaxation_factor;
+
+  /// The maximum number of differences kept for Anderson mixing
+  const unsigned int _history;
+
+  /// The current relaxation factor
+  Real _omega;
+
+  /// The residual of the previous iteration
+  std::unique_ptr<NumericVector<Number> > _residual_old;
+
+  /// The iterate of the previous iteration
+  std::unique_ptr<NumericVector<Number> > _iterate_old;
+
+  /// Differences between consecutive residuals (Anderson)
+  std::deque<std::unique_ptr<NumericVector<Number> > > _residual_diffs;
+
+  /// Differences between consecutive iterates (Anderson)
+  std::deque<std::unique_ptr<NumericVector<Number> > > _iterate_diffs;
+};
+
+#endif // PICARDACCELERATION_H
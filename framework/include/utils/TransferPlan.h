@@ -0,0 +1,91 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef TRANSFERPLAN_H
+#define TRANSFERPLAN_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+// libMesh includes
+#include "libmesh/id_types.h"
+#include "libmesh/point.h"
+#include "libmesh/numeric_vector.h"
+
+// C++ includes
+#include <vector>
+
+// libMesh forward declarations
+namespace libMesh
+{
+class Elem;
+class DofMap;
+}
+
+/**
+ * The linear map from source values to target values recorded by a transfer
+ * whose meshes do not change.
+ *
+ * Each row holds the source indices and weights that produce one target
+ * value, so that after the first execution a transfer only needs a sparse
+ * matrix-vector product instead of repeating the point location and
+ * interpolation.
+ */
+class TransferPlan
+{
+public:
+  TransferPlan();
+
+  /// Removes all of the rows
+  void clear();
+
+  /// Starts a new row; addEntry() adds to the last row started
+  void addRow();
+
+  /// Adds \p weight times source value \p source to the last row
+  void addEntry(dof_id_type source, Real weight);
+
+  /**
+   * Adds a row evaluating variable \p var_num at the physical point \p p
+   * inside \p elem, i.e. the values of its shape functions at \p p applied
+   * to the dofs of \p elem.
+   */
+  void addShapeFunctionRow(const Elem * elem, const DofMap & dof_map, unsigned int var_num, const Point & p);
+
+  /// The number of rows
+  std::size_t nRows() const { return _offsets.size() - 1; }
+
+  /// The number of entries in \p row
+  std::size_t rowSize(std::size_t row) const { return _offsets[row + 1] - _offsets[row]; }
+
+  /**
+   * Computes the value of \p row from the source values.
+   * @param row The row to evaluate
+   * @param source The source values, indexed by the source indices of the row
+   */
+  Number apply(std::size_t row, const NumericVector<Number> & source) const;
+  Number apply(std::size_t row, const std::vector<Number> & source) const;
+
+protected:
+  /// The entries of row i are [_offsets[i], _offsets[i+1])
+  std::vector<std::size_t> _offsets;
+
+  /// The source index of each entry
+  std::vector<dof_id_type> _sources;
+
+  /// The weight of each entry
+  std::vector<Real> _weights;
+};
+
+#endif // TRANSFERPLAN_H
@@ -32,7 +32,7 @@ protected:
   const MaterialProperty<std::vector<Real>> & _enthalpy;
 
   /// Derivative of the enthalpy wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _denthalpy_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _denthalpy_dvar;
 };
 
 #endif // POROUSFLOWFULLYSATURATEDHEATADVECTION_H
@@ -10,6 +10,7 @@
 
 #include "TimeKernel.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowDerivativeMatrix.h"
 
 class PorousFlowFullySaturatedMassTimeDerivative;
 
@@ -65,7 +66,7 @@ protected:
   const MaterialProperty<std::vector<Real>> * const _fluid_density;
 
   /// derivative of fluid density for each phase with respect to the PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _dfluid_density_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> * const _dfluid_density_dvar;
 
   /// Quadpoint pore pressure in each phase
   const MaterialProperty<std::vector<Real>> & _pp;
@@ -74,7 +75,7 @@ protected:
   const MaterialProperty<std::vector<Real>> & _pp_old;
 
   /// Derivative of porepressure in each phase wrt the PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dpp_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dpp_dvar;
 
   /// Quadpoint temperature
   const MaterialProperty<Real> * const _temperature;
@@ -10,6 +10,7 @@
 
 #include "TimeDerivative.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowDerivativeMatrix.h"
 
 // Forward Declarations
 class PorousFlowMassRadioactiveDecay;
@@ -66,13 +67,13 @@ protected:
   const MaterialProperty<std::vector<Real>> & _fluid_density;
 
   /// d(nodal fluid density)/d(porous-flow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dfluid_density_dvar;
 
   /// nodal fluid saturation
   const MaterialProperty<std::vector<Real>> & _fluid_saturation_nodal;
 
   /// d(nodal fluid saturation)/d(porous-flow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_saturation_nodal_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dfluid_saturation_nodal_dvar;
 
   /// nodal mass fraction
   const MaterialProperty<std::vector<std::vector<Real>>> & _mass_frac;
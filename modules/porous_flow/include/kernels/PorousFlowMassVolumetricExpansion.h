@@ -11,6 +11,7 @@
 #include "TimeDerivative.h"
 #include "PorousFlowDictator.h"
 #include "RankTwoTensor.h"
+#include "PorousFlowDerivativeMatrix.h"
 
 // Forward Declarations
 class PorousFlowMassVolumetricExpansion;
@@ -67,13 +68,13 @@ protected:
   const MaterialProperty<std::vector<Real>> & _fluid_density;
 
   /// d(fluid density)/d(porous-flow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dfluid_density_dvar;
 
   /// fluid saturation
   const MaterialProperty<std::vector<Real>> & _fluid_saturation;
 
   /// d(fluid saturation)/d(porous-flow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_saturation_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dfluid_saturation_dvar;
 
   /// mass fraction
   const MaterialProperty<std::vector<std::vector<Real>>> & _mass_frac;
@@ -9,6 +9,7 @@
 #define POROUSFLOWJOINER_H
 
 #include "PorousFlowMaterialVectorBase.h"
+#include "PorousFlowDerivativeMatrix.h"
 
 //Forward Declarations
 class PorousFlowJoiner;
@@ -62,10 +63,10 @@ protected:
   const bool _include_old;
 
   /// Derivatives of porepressure variable wrt PorousFlow variables at the qps or nodes
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dporepressure_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dporepressure_dvar;
 
   /// Derivatives of saturation variable wrt PorousFlow variables at the qps or nodes
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dsaturation_dvar;
+  const MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dsaturation_dvar;
 
   /// Derivatives of temperature variable wrt PorousFlow variables at the qps or nodes
   const MaterialProperty<std::vector<Real>> & _dtemperature_dvar;
@@ -74,7 +75,7 @@ protected:
   MaterialProperty<std::vector<Real>> & _property;
 
   /// d(property)/d(PorousFlow variable)
-  MaterialProperty<std::vector<std::vector<Real>>> & _dproperty_dvar;
+  MaterialProperty<PorousFlowDerivativeMatrix<Real>> & _dproperty_dvar;
 
   /// property of each phase
   std::vector<const MaterialProperty<Real> *> _phase_property;
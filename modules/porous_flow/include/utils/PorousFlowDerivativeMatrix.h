@@ -0,0 +1,74 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef POROUSFLOWDERIVATIVEMATRIX_H
+#define POROUSFLOWDERIVATIVEMATRIX_H
+
+#include "MooseError.h"
+#include "DataIO.h"
+
+#include <vector>
+
+/**
+ * Derivatives of a quantity of each phase (the rows) with respect to the
+ * PorousFlow variables (the columns) at one quadpoint.
+ *
+ * The entries are stored contiguously (row major), so a quadpoint holds a
+ * single allocation instead of the one-per-phase of a
+ * std::vector<std::vector<T>>.  The sizes come from the PorousFlowDictator
+ * and are set with resizeAndZero(), which only allocates when growing.
+ */
+template <typename T>
+class PorousFlowDerivativeMatrix
+{
+public:
+  PorousFlowDerivativeMatrix() : _n_rows(0), _n_cols(0) {}
+
+  /// Sets the size to n_rows x n_cols with all entries zero
+  void resizeAndZero(unsigned int n_rows, unsigned int n_cols)
+  {
+    _n_rows = n_rows;
+    _n_cols = n_cols;
+    _data.assign(n_rows * n_cols, T());
+  }
+
+  unsigned int rows() const { return _n_rows; }
+  unsigned int cols() const { return _n_cols; }
+
+  T & operator()(unsigned int row, unsigned int col)
+  {
+    mooseAssert(row < _n_rows && col < _n_cols, "PorousFlowDerivativeMatrix entry (" << row << ", " << col << ") out of range");
+    return _data[row * _n_cols + col];
+  }
+
+  const T & operator()(unsigned int row, unsigned int col) const
+  {
+    mooseAssert(row < _n_rows && col < _n_cols, "PorousFlowDerivativeMatrix entry (" << row << ", " << col << ") out of range");
+    return _data[row * _n_cols + col];
+  }
+
+  friend void dataStore(std::ostream & stream, PorousFlowDerivativeMatrix<T> & m, void * context)
+  {
+    dataStore(stream, m._n_rows, context);
+    dataStore(stream, m._n_cols, context);
+    dataStore(stream, m._data, context);
+  }
+
+  friend void dataLoad(std::istream & stream, PorousFlowDerivativeMatrix<T> & m, void * context)
+  {
+    dataLoad(stream, m._n_rows, context);
+    dataLoad(stream, m._n_cols, context);
+    dataLoad(stream, m._data, context);
+  }
+
+private:
+  unsigned int _n_rows;
+  unsigned int _n_cols;
+  std::vector<T> _data;
+};
+
+#endif //POROUSFLOWDERIVATIVEMATRIX_H
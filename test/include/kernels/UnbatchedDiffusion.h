@@ -0,0 +1,35 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef UNBATCHEDDIFFUSION_H
+#define UNBATCHEDDIFFUSION_H
+
+#include "Diffusion.h"
+
+class UnbatchedDiffusion;
+
+template<>
+InputParameters validParams<UnbatchedDiffusion>();
+
+/**
+ * Diffusion evaluated through the generic computeQpResidual() and computeQpJacobian() loops instead of
+ * the batched ones, used to check the batched loops against the reference implementation
+ */
+class UnbatchedDiffusion : public Diffusion
+{
+public:
+  UnbatchedDiffusion(const InputParameters & parameters);
+};
+
+#endif /* UNBATCHEDDIFFUSION_H */
@@ -0,0 +1,35 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef UNBATCHEDTIMEDERIVATIVE_H
+#define UNBATCHEDTIMEDERIVATIVE_H
+
+#include "TimeDerivative.h"
+
+class UnbatchedTimeDerivative;
+
+template<>
+InputParameters validParams<UnbatchedTimeDerivative>();
+
+/**
+ * TimeDerivative evaluated through the generic computeQpResidual() and computeQpJacobian() loops instead of
+ * the batched ones, used to check the batched loops against the reference implementation
+ */
+class UnbatchedTimeDerivative : public TimeDerivative
+{
+public:
+  UnbatchedTimeDerivative(const InputParameters & parameters);
+};
+
+#endif /* UNBATCHEDTIMEDERIVATIVE_H */
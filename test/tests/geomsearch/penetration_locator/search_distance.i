@@ -0,0 +1,92 @@
+###########################################################
+# The slave nodes on leftright (x = -2, y = 10, 10.6, 11.2)
+# are 1 away from the master boundary rightleft (x = -1).
+# With search_distance = 1.5 they project onto it as usual,
+# with search_distance = 0.5 no master face is a candidate
+# and the nodes are reported as not penetrated (-999999).
+###########################################################
+
+[Mesh]
+  file = ../patch_update_strategy/long_range.e
+  dim = 2
+[]
+
+[Variables]
+  [./u]
+    block = right
+  [../]
+[]
+
+[AuxVariables]
+  [./closest_x]
+  [../]
+  [./closest_y]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./closest_x]
+    type = PenetrationAux
+    variable = closest_x
+    quantity = closest_point_x
+    boundary = leftright
+    paired_boundary = rightleft
+    search_distance = 1.5
+  [../]
+  [./closest_y]
+    type = PenetrationAux
+    variable = closest_y
+    quantity = closest_point_y
+    boundary = leftright
+    paired_boundary = rightleft
+    search_distance = 1.5
+  [../]
+[]
+
+[BCs]
+  [./top]
+    type = DirichletBC
+    variable = u
+    boundary = righttop
+    value = 1
+  [../]
+  [./bottom]
+    type = DirichletBC
+    variable = u
+    boundary = rightbottom
+    value = 0
+  [../]
+[]
+
+[Postprocessors]
+  [./closest_x]
+    type = NodalSum
+    variable = closest_x
+    boundary = leftright
+  [../]
+  [./closest_y]
+    type = NodalSum
+    variable = closest_y
+    boundary = leftright
+  [../]
+[]
+
+[Problem]
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+[]
+
+[Outputs]
+  csv = true
+[]
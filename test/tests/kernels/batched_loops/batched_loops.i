@@ -0,0 +1,81 @@
+# u uses the batched Diffusion and TimeDerivative loops, v the generic per quadrature point loops
+# of the same kernels: both solutions must be identical.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+  [../]
+[]
+
+[Kernels]
+  [./diff_u]
+    type = Diffusion
+    variable = u
+  [../]
+  [./time_u]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./diff_v]
+    type = UnbatchedDiffusion
+    variable = v
+  [../]
+  [./time_v]
+    type = UnbatchedTimeDerivative
+    variable = v
+  [../]
+[]
+
+[BCs]
+  [./left_u]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right_u]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+  [./left_v]
+    type = DirichletBC
+    variable = v
+    boundary = left
+    value = 0
+  [../]
+  [./right_v]
+    type = DirichletBC
+    variable = v
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./difference]
+    type = ElementL2Difference
+    variable = u
+    other_variable = v
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 0.1
+  solve_type = NEWTON
+  nl_abs_tol = 1e-12
+[]
+
+[Outputs]
+  csv = true
+[]
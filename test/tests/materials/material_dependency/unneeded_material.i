@@ -0,0 +1,74 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = MatDiffusion
+    variable = u
+    prop_name = 'diff'
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./diff_mat]
+    type = GenericConstantMaterial
+    prop_names = 'diff'
+    prop_values = '1'
+    block = 0
+  [../]
+
+  # Only needed by the postprocessor, so it must not be computed during the
+  # residual and Jacobian evaluations
+  [./call_me_mat]
+    type = IncrementMaterial
+    prop_names = 'unused'
+    prop_values = '1'
+    block = 0
+  [../]
+[]
+
+[Postprocessors]
+  [./mat_prop_integral]
+    type = ElementIntegralMaterialProperty
+    mat_prop = mat_prop
+    execute_on = timestep_end
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'PJFNK'
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = timestep_end
+  [../]
+[]
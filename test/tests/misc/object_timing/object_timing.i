@@ -0,0 +1,75 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./aux]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = MatDiffusion
+    variable = u
+    prop_name = conductivity
+  [../]
+[]
+
+[AuxKernels]
+  [./aux]
+    type = MaterialRealAux
+    variable = aux
+    property = conductivity
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = NeumannBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./conductivity]
+    type = GenericConstantMaterial
+    prop_names = conductivity
+    prop_values = 2
+  [../]
+[]
+
+[Postprocessors]
+  [./integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = u
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  exodus = true
+[]
@@ -0,0 +1,98 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Functions]
+  [./x_plus_y]
+    type = ParsedFunction
+    value = x+y
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./lambda]
+    family = SCALAR
+    order = FIRST
+  [../]
+[]
+
+[AuxVariables]
+  [./nodal_aux]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[ScalarKernels]
+  [./ode]
+    type = ParsedODEKernel
+    variable = lambda
+    function = 'lambda - 1'
+  [../]
+[]
+
+[NodalKernels]
+  [./rate]
+    type = ConstantRate
+    variable = u
+    rate = 1
+  [../]
+[]
+
+[DiracKernels]
+  [./point]
+    type = ConstantPointSource
+    variable = u
+    value = 1
+    point = '0.5 0.5 0'
+  [../]
+[]
+
+[AuxKernels]
+  [./nodal_aux]
+    type = FunctionAux
+    variable = nodal_aux
+    function = x_plus_y
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+[]
+
+[Postprocessors]
+  [./max]
+    type = NodalMaxValue
+    variable = u
+  [../]
+  [./dofs]
+    type = NumDOFs
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
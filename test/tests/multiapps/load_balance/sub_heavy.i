@@ -0,0 +1,51 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 200
+  ny = 200
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./td]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./source]
+    type = BodyForce
+    variable = u
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  # With no flux through the boundary and a zero initial condition u = t exactly, so this
+  # checks that the state of the Apps survives their redistribution and recovery
+  [./average]
+    type = ElementAverageValue
+    variable = u
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,67 @@
+#!/usr/bin/env python
+import os, sys
+import subprocess
+import unittest
+
+def find_app():
+    """
+    Find the executable to use, respecting MOOSE_DIR and METHOD
+    """
+    moose_dir = os.environ.get("MOOSE_DIR")
+    if not moose_dir:
+        p = subprocess.Popen('git rev-parse --show-cdup', stdout=subprocess.PIPE, stderr=subprocess.PIPE, shell=True)
+        p.wait()
+        if p.returncode == 0:
+            git_dir = p.communicate()[0].decode("utf-8")
+            moose_dir = os.path.abspath(os.path.join(os.getcwd(), git_dir)).rstrip()
+        else:
+            print("Could not find top level moose directory. Please set the MOOSE_DIR environment variable.")
+            sys.exit(1)
+
+    app_name = os.path.join(moose_dir, "test", "moose_test-%s" % os.environ.get("METHOD", "opt"))
+    return app_name
+
+def run_app(args=[]):
+    """
+    Run the app and return the output.
+    Exits if the app failed to run for any reason.
+    """
+    proc = None
+    args.insert(0, find_app())
+    cmd_line = ' '.join(args)
+    try:
+        proc = subprocess.Popen(args, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    except OSError as e:
+        print("Problem running '%s'\nError: %s" % (cmd_line, e))
+        sys.exit(1)
+
+    data = proc.communicate()
+    stdout_data = data[0].decode("utf-8")
+    if proc.returncode != 0:
+        print("Failed with exit code %s" % proc.returncode)
+        sys.exit(proc.returncode)
+    return stdout_data
+
+class TestCSVStreaming(unittest.TestCase):
+    """
+    Compare the CSV files written with and without streaming
+    """
+    def writeCSV(self, file_base, streaming):
+        # The postprocessor column is only added by the final output, so a streamed file is
+        # rewritten with the rows read back from it
+        run_app(["-i", "csv_transient.i", "Outputs/csv=false", "Outputs/out/type=CSV",
+                 "Outputs/out/file_base=%s" % file_base, "Outputs/out/execute_postprocessors_on=final",
+                 "Outputs/out/streaming=%s" % ("true" if streaming else "false")])
+        with open(file_base + ".csv") as f:
+            return f.read().splitlines()
+
+    def testAddedColumn(self):
+        rewritten = self.writeCSV("csv_transient_rewritten_out", False)
+        streamed = self.writeCSV("csv_transient_streamed_out", True)
+
+        self.assertEqual(len(rewritten), 21)
+        self.assertIn("mid_point", rewritten[0].split(","))
+        self.assertEqual(streamed, rewritten)
+
+if __name__ == '__main__':
+    unittest.main(module=__name__, verbosity=2)
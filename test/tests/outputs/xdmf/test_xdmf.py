@@ -0,0 +1,116 @@
+#!/usr/bin/env python
+import os, sys
+import subprocess
+import struct
+import unittest
+import xml.etree.ElementTree as ET
+from distutils.spawn import find_executable
+
+def find_app():
+    """
+    Find the executable to use, respecting MOOSE_DIR and METHOD
+    """
+    moose_dir = os.environ.get("MOOSE_DIR")
+    if not moose_dir:
+        p = subprocess.Popen('git rev-parse --show-cdup', stdout=subprocess.PIPE, stderr=subprocess.PIPE, shell=True)
+        p.wait()
+        if p.returncode == 0:
+            git_dir = p.communicate()[0].decode("utf-8")
+            moose_dir = os.path.abspath(os.path.join(os.getcwd(), git_dir)).rstrip()
+        else:
+            print("Could not find top level moose directory. Please set the MOOSE_DIR environment variable.")
+            sys.exit(1)
+
+    app_name = os.path.join(moose_dir, "test", "moose_test-%s" % os.environ.get("METHOD", "opt"))
+    return app_name
+
+def run_app(args=[], n_procs=1):
+    """
+    Run the app, in parallel with mpiexec if n_procs > 1.
+    Exits if the app failed to run for any reason.
+    """
+    proc = None
+    args.insert(0, find_app())
+    if n_procs > 1:
+        args = ["mpiexec", "-n", str(n_procs)] + args
+    cmd_line = ' '.join(args)
+    try:
+        proc = subprocess.Popen(args, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    except OSError as e:
+        print("Problem running '%s'\nError: %s" % (cmd_line, e))
+        sys.exit(1)
+
+    data = proc.communicate()
+    stdout_data = data[0].decode("utf-8")
+    if proc.returncode != 0:
+        print("Failed with exit code %s" % proc.returncode)
+        sys.exit(proc.returncode)
+    return stdout_data
+
+def read_data_item(item):
+    """
+    Read the values of a binary DataItem at its Seek offset
+    """
+    size = 1
+    for d in item.attrib["Dimensions"].split():
+        size *= int(d)
+    fmt = "q" if item.attrib["NumberType"] == "Int" else "d"
+    with open(item.text.strip(), "rb") as f:
+        f.seek(int(item.attrib["Seek"]))
+        data = f.read(8 * size)
+    if len(data) != 8 * size:
+        raise ValueError("The file '%s' is too short" % item.text.strip())
+    return struct.unpack("=%d%s" % (size, fmt), data)
+
+class TestXDMF(unittest.TestCase):
+    """
+    Read back the binary arrays described by the XDMF file of xdmf.i
+    """
+    def checkOutput(self, file_base, n_procs):
+        run_app(["-i", "xdmf.i", "Outputs/file_base=%s" % file_base], n_procs)
+
+        grids = ET.parse(file_base + ".xmf").getroot().find("Domain").find("Grid").findall("Grid")
+        self.assertEqual(len(grids), 3)
+
+        for step, grid in enumerate(grids):
+            self.assertAlmostEqual(float(grid.find("Time").attrib["Value"]), 0.1 * step)
+
+            # The nodes of the 2x2 mesh of the unit square
+            coords = read_data_item(grid.find("Geometry").find("DataItem"))
+            nodes = [coords[3 * i:3 * i + 3] for i in range(len(coords) // 3)]
+            self.assertEqual(sorted(nodes), sorted([(0.5 * i, 0.5 * j, 0.) for i in range(3) for j in range(3)]))
+
+            # Four QUAD4 elements, each one a square with a side of 0.5
+            topology = read_data_item(grid.find("Topology").find("DataItem"))
+            self.assertEqual(len(topology), 20)
+            for e in range(4):
+                self.assertEqual(topology[5 * e], 5)
+                elem_nodes = [nodes[n] for n in topology[5 * e + 1:5 * e + 5]]
+                self.assertAlmostEqual(max(n[0] for n in elem_nodes) - min(n[0] for n in elem_nodes), 0.5)
+                self.assertAlmostEqual(max(n[1] for n in elem_nodes) - min(n[1] for n in elem_nodes), 0.5)
+
+            attributes = dict((a.attrib["Name"], read_data_item(a.find("DataItem"))) for a in grid.findall("Attribute"))
+
+            # u is zero initially, then it satisfies the boundary conditions on the left and the right
+            for node, u in zip(nodes, attributes["u"]):
+                if step == 0:
+                    self.assertEqual(u, 0)
+                elif node[0] == 0:
+                    self.assertAlmostEqual(u, 0, places=5)
+                elif node[0] == 1:
+                    self.assertAlmostEqual(u, 1, places=5)
+                else:
+                    self.assertTrue(0 < u < 1)
+
+            self.assertEqual(attributes["aux"], (0., 0., 0., 0.))
+
+    def testSerial(self):
+        self.checkOutput("xdmf_read_serial", 1)
+
+    def testParallel(self):
+        if not find_executable("mpiexec"):
+            self.skipTest("mpiexec was not found")
+        self.checkOutput("xdmf_read_parallel", 2)
+
+if __name__ == '__main__':
+    unittest.main(module=__name__, verbosity=2)
@@ -0,0 +1,90 @@
+# Nearest node transfer from a moving sub-app mesh.  The sub-app mesh is
+# displaced every time step, so the nearest node connections cannot be cached
+# and the search is redone on every transfer.  Scale the problem with e.g.
+#   Mesh/nx=1000 Mesh/ny=1000 sub:Mesh/nx=1000 sub:Mesh/ny=1000
+# and compare the timings of the transfers in the performance log.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 100
+  ny = 100
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./from_sub]
+  [../]
+  [./elemental_from_sub]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 1
+
+  solve_type = 'NEWTON'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  print_perf_log = true
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    positions = '0 0 0'
+    input_files = benchmark_sub.i
+  [../]
+[]
+
+[Transfers]
+  [./from_sub]
+    type = MultiAppNearestNodeTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = from_sub
+    displaced_source_mesh = true
+  [../]
+  [./elemental_from_sub]
+    type = MultiAppNearestNodeTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = elemental_from_sub
+    displaced_source_mesh = true
+  [../]
+[]
@@ -0,0 +1,36 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BOUNDINGBOXTREETEST_H
+#define BOUNDINGBOXTREETEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class BoundingBoxTreeTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( BoundingBoxTreeTest );
+
+  CPPUNIT_TEST( findBoxesTest );
+  CPPUNIT_TEST( refitTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void findBoxesTest();
+  void refitTest();
+};
+
+#endif  // BOUNDINGBOXTREETEST_H
@@ -0,0 +1,39 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef DATAIOTEST_H
+#define DATAIOTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class DataIOTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( DataIOTest );
+
+  CPPUNIT_TEST( vectorLayout );
+  CPPUNIT_TEST( vectorRoundTrip );
+  CPPUNIT_TEST( setRoundTrip );
+  CPPUNIT_TEST( mapRoundTrip );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void vectorLayout();
+  void vectorRoundTrip();
+  void setRoundTrip();
+  void mapRoundTrip();
+};
+
+#endif  // DATAIOTEST_H
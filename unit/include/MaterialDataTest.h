@@ -0,0 +1,36 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MATERIALDATATEST_H
+#define MATERIALDATATEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class MaterialDataTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( MaterialDataTest );
+
+  CPPUNIT_TEST( arenaTest );
+  CPPUNIT_TEST( arenaOverflowTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void arenaTest();
+  void arenaOverflowTest();
+};
+
+#endif  // MATERIALDATATEST_H
@@ -0,0 +1,36 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MATERIALPROPERTYSTORAGETEST_H
+#define MATERIALPROPERTYSTORAGETEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class MaterialPropertyStorageTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( MaterialPropertyStorageTest );
+
+  CPPUNIT_TEST( slotsTest );
+  CPPUNIT_TEST( slotsShiftTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void slotsTest();
+  void slotsShiftTest();
+};
+
+#endif  // MATERIALPROPERTYSTORAGETEST_H
@@ -0,0 +1,42 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef PERFGRAPHTEST_H
+#define PERFGRAPHTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class PerfGraphTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( PerfGraphTest );
+
+  CPPUNIT_TEST( registerSection );
+  CPPUNIT_TEST( nesting );
+  CPPUNIT_TEST( disabled );
+  CPPUNIT_TEST( mismatch );
+  CPPUNIT_TEST( printing );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void registerSection();
+  void nesting();
+  void disabled();
+  void mismatch();
+  void printing();
+};
+
+#endif //PERFGRAPHTEST_H
@@ -0,0 +1,39 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef POROUSFLOWDERIVATIVEMATRIXTEST_H
+#define POROUSFLOWDERIVATIVEMATRIXTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+// Moose includes
+#include "PorousFlowDerivativeMatrix.h"
+
+class PorousFlowDerivativeMatrixTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( PorousFlowDerivativeMatrixTest );
+
+  CPPUNIT_TEST( resizeTest );
+  CPPUNIT_TEST( storeLoadTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void resizeTest();
+  void storeLoadTest();
+};
+
+#endif  // POROUSFLOWDERIVATIVEMATRIXTEST_H
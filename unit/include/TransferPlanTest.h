@@ -0,0 +1,36 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef TRANSFERPLANTEST_H
+#define TRANSFERPLANTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class TransferPlanTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( TransferPlanTest );
+
+  CPPUNIT_TEST( applyTest );
+  CPPUNIT_TEST( clearTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void applyTest();
+  void clearTest();
+};
+
+#endif  // TRANSFERPLANTEST_H